@@ -1,668 +1,541 @@
 #include <avr/io.h>
 #include "lcd.h"
-#include "math.h"
 #include <util/delay.h>
 #include <avr/interrupt.h>
+#include <util/atomic.h>
 #include <switches.h>
-#include <stdlib.h>
-
-#define PI 3.14159265
-
-#define START_STATE 0
-#define PLAY_STATE 1
-#define END_STATE 2
-
-#define DEAD 0
-#define INVINCIBLE 1
-#define VINCIBLE 2
-
-#define NO_ASTEROIDS 12
-#define NO_DEBRIS 10
-#define NO_BULLETS 10
-#define ASTEROID_PERIOD 64
-#define TURN_ANGLE 0.23
-#define ASTEROID_POINTS 4
-#define SHIP_POINTS 8
-#define SHIP_ACCELERATION 0.9
-#define SHIP_DECELERATION 0.2
-#define BIG_SIZE 40
-#define MID_SIZE 30
-#define SMALL_SIZE 15
-#define TICK_MS 50
-#define PENALTY 5
-
-typedef struct {
-	float x;
-	float y;
-} Point;
+#include "game.h"
+#include "autopilot.h"
+#include "render.h"
+#include "eewrite.h"
+#include "recorder.h"
+#include "replay.h"
+#include "store.h"
+#include "splash.h"
+#include "power.h"
+#include "clock.h"
+#include "rotary.h"
+#include "latency.h"
+#include "stack.h"
+#include "telemetry.h"
+#include "trace.h"
+#include <avr/eeprom.h>
 
-typedef struct {
-	Point origin;
-	Point points[SHIP_POINTS];
-	
-	uint8_t state;
-	uint8_t thrusting;
-	
-	float x_inc;
-	float y_inc;
-	float x_dec;
-	float y_dec;
-	float angle;
-	
-	float horz_v;
-	float vert_v;
-} Ship;
-
-typedef struct {
-	uint16_t x;
-	uint16_t y;
-	int16_t x_inc;
-	int16_t y_inc;
-} Bullet;
-
-typedef struct {
-	uint16_t x;
-	uint16_t y;
-	int16_t x_inc;
-	int16_t y_inc;
-} Shrapnel;
-
-typedef struct {
-	Point origin;
-	Point points[ASTEROID_POINTS];
-	float x_inc;
-	float y_inc;
-	uint8_t size;
-} Asteroid;
-
-typedef struct {
-	Point points[2];
-	float x_inc;
-	float y_inc;
-} Wreckage;
+#define TICK_MS 50
+#define MAX_CATCHUP 4
+#define TICKS_PER_MIN (60000 / TICK_MS)
+#define TICKS_PER_SEC (1000 / TICK_MS)
+#define LIVES 3
+#define END_TICKS (10 * TICKS_PER_SEC) // Game over screen, unless CENTER.
+#define SETTINGS_SAVE_TICKS (2 * TICKS_PER_SEC) // Once the knobs are left.
+#define SPLASH_TICKS (3 * TICKS_PER_SEC) // Title screen, unless a press.
+#define ATTRACT_DIM_TICKS (30 * TICKS_PER_SEC) // Untouched attract mode dims.
+#define BRIGHTNESS_STEP 16
+#define FRAME_RATE_STEP 2
 
 void init();
-void rotate_ship(float angle);
-void handle_input();
+void tick();
 void draw();
-void update();
-void thrust_ship();
-void draw_asteroids();
-void gen_asteroids();
-void place_ship();
-void init_pro();
-void add_asteroid(float x, float y, float speed, float direction, float size);
-
-uint8_t game_state = 0;
-uint16_t score = 0;
-
-Ship ship;
-Ship last_ship;
-
-// "Stack for the debris
-Shrapnel debris[NO_DEBRIS];
-uint8_t debris_l;
-uint8_t debris_h;
-Shrapnel last_debris[NO_DEBRIS];
-uint8_t debris_last_l;
-uint8_t debris_last_h;
-
-// "Stack" for the bullets. 
-Bullet bullets[NO_BULLETS];
-uint8_t bullet_l;
-uint8_t bullet_h;
-Bullet last_bullets[NO_BULLETS];
-uint8_t bullet_last_l;
-uint8_t bullet_last_h;
-
-// "Stack" for the asteroids; 
-Asteroid asteroids[NO_ASTEROIDS+1];
-Asteroid last_asteroids[NO_ASTEROIDS];
-uint8_t asteroid_i;
-
-Wreckage wreckages[4];
-Wreckage last_wreckages[4];
-uint8_t wreckage_life;
-
-uint16_t inv_timer = 0;
-uint16_t respawn_timer = 0;
+void step();
+void boot_lcd();
+void read_input(GameInput *in);
+void start_game();
+void start_playback();
+void attract();
+void game_over();
+void adjust_settings(const GameInput *in);
+void draw_soak();
+void adapt_budget(uint16_t elapsed);
+void send_telemetry(uint8_t steps, uint8_t events, uint16_t step_t, 
+	uint16_t draw_t, uint16_t start);
+
+Game game;
+uint8_t paused = 0;
+uint8_t lives;
+uint16_t end_ticks;
+uint8_t splash_ticks = SPLASH_TICKS;
+
+// Settings (brightness and frame_rate, in power.c) are adjusted in attract
+// mode and saved once left alone.
+uint8_t settings_wait = 0; // Ticks until the settings are saved, 0 if they are.
+uint16_t attract_quiet = 0; // Ticks since the last input in attract mode.
+
+// Tick overrun bookkeeping. Frame times are in TIMER1 counts (128us).
+uint16_t missed_ticks = 0;
+uint16_t worst_frame = 0;
+uint8_t lag = 0;
+volatile uint8_t in_tick = 0;
+volatile uint8_t overruns = 0; // Matches while the last tick was running.
+
+// Attract mode soak log: the worst frame and missed ticks above cover the
+// whole run, this says how long it has been going.
+uint16_t soak_minutes = 0;
+uint16_t soak_ticks = 0;
+uint8_t overlay_stale = 1; // Draw the overlay now, not at the next second.
+#ifdef SOAK
+uint8_t stress = 1;
+#else
+uint8_t stress = 0;
+#endif
+
+uint16_t EEMEM boot_count;
+uint16_t seed;
+volatile uint8_t lcd_up = 0;
+uint16_t first_frame_ms = 0; // Power-on to first complete frame.
 
 void main(void) {
 	init();
-	sei();
-	while (1) {}
+	while (1)
+		power_idle();
 }
 
 
-ISR(TIMER1_COMPA_vect) {
-	static uint8_t a_timer = ASTEROID_PERIOD;
-	if (a_timer == 0) {
-		gen_asteroids();
-		a_timer = ASTEROID_PERIOD;
+/*
+ * Runs a tick with interrupts back on, so the switch sampler, the rotary
+ * encoder and the clock are served while a frame is drawn. A compare match
+ * that comes while the last tick is still running only counts an overrun
+ * for tick() to make up.
+ */
+ISR(TIMER1_COMPA_vect, ISR_NOBLOCK) {
+	if (in_tick) {
+		overruns++;
+		return;
 	}
-
-	handle_input();
-	update();
-	draw();
-   
-	a_timer--;
-}
-
-void init() {	
-	/* 8MHz clock, no prescaling (DS, p. 48) */
-    CLKPR = (1 << CLKPCE);
-    CLKPR = 0;
-
-    init_lcd();
-    init_switches();
-    
-    // Enable encoder reading pull-ups.
-    DDRE &= ~_BV(PE4);
-    PORTE |= _BV(PE4); 
-    DDRE &= ~_BV(PE5);
-    PORTE |= _BV(PE5);
-	
-	place_ship();
-	
-	bullet_l = 0;
-	bullet_h = 0;
-	bullet_last_l = 0;
-	bullet_last_h = 0;
-	
-	debris_l = 0;
-	debris_h = 0;
-	debris_last_l = 0;
-	debris_last_h = 0;
-
-	asteroid_i = 0;
-	
-	/* Configure 16 bit Timer for ISR  */
-    TCCR1B = _BV(WGM12)   /* Clear Timer on Compare match (CTC) Mode */
-           | _BV(CS12)
-           | _BV(CS10);   /* F_CPU / 1024 */
-
-    OCR1A = (uint16_t)(F_CPU * TICK_MS / (1024.0 * 1000)- 0.5);
-
-    TIMSK1 = _BV(OCIE1A); /* enable compare match interrupt */
-    TCNT1 = 0;
+	in_tick = 1;
+	tick();
+	// Interrupts stay off until reti, so the next tick cannot nest here.
+	cli();
+	in_tick = 0;
 }
 
 /*
- * Rotates the point p about the point o.
+ * Runs the physics steps owed since the last tick, then renders once. If the
+ * compare match fired again while we were busy, the tick is counted as missed
+ * and made up by an extra physics step next time, so game speed stays
+ * constant even when a frame takes longer than TICK_MS to draw.
  */
-Point rotate_point (float sin_res, float cos_res, Point p, Point o) {
-	float x = p.x - o.x;
-	float y = p.y - o.y;
-	float x_rot = x * cos_res - y * sin_res;
-	float y_rot = x * sin_res + y * cos_res;
-	
-	p.x = x_rot + o.x;
-	p.y = y_rot + o.y;
+void tick() {
+	TRACE_BEGIN(TR_TICK);
+	uint16_t t0 = clock_now();
+	uint8_t events = input_tick();
+	if (down_pressed() && game.state == START_STATE) {
+		stress = !stress;
+		game.stress = stress;
+	} else if (down_pressed() && game.state == PLAY_STATE) {
+		paused = !paused;
+		if (paused)
+			record_sync(&game);
+		power_level(paused ? POWER_STATIC : POWER_ACTIVE);
+		display_color(WHITE, BLACK);
+		display_string_xy(paused?"PAUSED":"      ", 142, 116);
+	}
+	if (paused) {
+		power_account(TCNT1, OCR1A + 1);
+		TRACE_END(TR_TICK);
+		return;
+	}
+
+	uint8_t steps = lag + 1;
+	if (steps > MAX_CATCHUP)
+		steps = MAX_CATCHUP;
+	lag = 0;
+
+	uint8_t ran = steps;
+	while (steps--) {
+		TRACE_BEGIN(TR_STEP);
+		step();
+		TRACE_END(TR_STEP);
+		// Catch-up steps only see input that arrived since the last one.
+		if (steps)
+			events += input_tick();
+	}
+	uint16_t t1 = clock_now();
+	TRACE_BEGIN(TR_DRAW);
+	draw();
+	TRACE_END(TR_DRAW);
+	uint16_t t2 = clock_now();
+	if (!first_frame_ms)
+		first_frame_ms = clock_us() / 1000;
 	
-	return p;
+	send_telemetry(ran, events, t1 - t0, t2 - t1, t0);
+
+	uint16_t elapsed;
+	uint8_t missed;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		elapsed = TCNT1;
+		missed = overruns;
+		overruns = 0;
+		if (TIFR1 & _BV(OCF1A)) {
+			// Clear a match not yet served; it is paid back with the rest.
+			TIFR1 = _BV(OCF1A);
+			elapsed = TCNT1;
+			missed++;
+		}
+	}
+	if (missed) {
+		elapsed += (OCR1A + 1) * missed;
+		missed_ticks += missed;
+		lag += missed;
+		TRACE_INSTANT(TR_OVERRUN);
+		trace_freeze();
+	}
+	if (elapsed > worst_frame)
+		worst_frame = elapsed;
+
+	adapt_budget(elapsed);
+	power_account(elapsed, OCR1A + 1);
+	stack_check();
+	TRACE_END(TR_TICK);
 }
 
 /*
- * Rotates the space ship by the given angle.
+ * Sends this frame's counters over the telemetry link, and the latency
+ * histogram every TELE_LATENCY_EVERY frames.
  */
-void rotate_ship (float angle) {
-	float sin_result = sin(angle);
-	float cos_result = cos(angle);
-	
-	ship.angle += angle;
-	
+void send_telemetry(uint8_t steps, uint8_t events, uint16_t step_t, 
+		uint16_t draw_t, uint16_t start) {
+	static uint8_t frames = 0;
+	tele_tick t;
 	uint8_t i;
-	for (i = 0; i < SHIP_POINTS; i++)
-		ship.points[i] =
-			rotate_point(sin_result, cos_result, ship.points[i], ship.origin);
 	
-	ship.x_inc = cos(ship.angle);
-	ship.y_inc = sin(ship.angle);
-	ship.x_dec = cos(ship.angle-3.14159265);
-	ship.y_dec = sin(ship.angle-3.14159265);
+	t.tick = game.tick;
+	t.step_t = step_t;
+	t.draw_t = draw_t;
+	t.lcd_budget_used = render_budget - budget_left;
+	t.missed = missed_ticks;
+	t.steps = steps;
+	t.asteroids = game_asteroids(&game);
+	t.bullets = game_bullets(&game);
+	t.debris = game_debris(&game);
+	t.events = events;
+	t.held = switch_held(BTN_UP) << BTN_UP | switch_held(BTN_RIGHT) << BTN_RIGHT
+		| switch_held(BTN_DOWN) << BTN_DOWN | switch_held(BTN_LEFT) << BTN_LEFT
+		| switch_held(BTN_CENTER) << BTN_CENTER;
+	t.idle = idle_percent;
+	t.frame_t = clock_now() - start;
+	telemetry_send(TELE_TICK, &t, sizeof(t));
+	trace_dump_step();
+	
+	if (++frames == 0) {
+		tele_latency l;
+		l.count = latency_count;
+		l.max_ms = latency_max_us / 1000;
+		l.bucket_us = LAT_BUCKET_US;
+		for (i = 0; i < sizeof(l.hist) / sizeof(l.hist[0]); i++)
+			l.hist[i] = latency_hist[i];
+		telemetry_send(TELE_LATENCY, &l, sizeof(l));
+	}
 }
 
 /*
- *	Thrusts the space ship in the direction it is facing.
+ * Adjusts the render budget from the measured frame time: backs off by an
+ * eighth when the frame used more than 3/4 of the tick, and creeps back up
+ * while there is time to spare.
  */
-void thrust_ship() {
-	uint8_t i;
-	for (i = 0; i < SHIP_POINTS; i++) {
-		ship.points[i].x += ship.horz_v;
-		ship.points[i].y += ship.vert_v;
-	}
-	ship.origin.x += ship.horz_v;
-	ship.origin.y += ship.vert_v;
-	
-	// Wrap-around
-	if (ship.origin.x > 350) {
-		ship.origin.x -= 400;
-		for (i = 0; i < SHIP_POINTS; i++)
-			ship.points[i].x -= 400;
-	}
-	if (ship.origin.x < -30) {
-		ship.origin.x += 400;
-		for (i = 0; i < SHIP_POINTS; i++)
-			ship.points[i].x += 400;
-	}
-	if (ship.origin.y > 270) {
-		ship.origin.y -= 320;
-		for (i = 0; i < SHIP_POINTS; i++)
-			ship.points[i].y -= 320;
-	}
-	if (ship.origin.y < -30) {
-		ship.origin.y += 320;
-		for (i = 0; i < SHIP_POINTS; i++)
-			ship.points[i].y += 320;
+void adapt_budget(uint16_t elapsed) {
+	if (elapsed > (OCR1A + 1) / 4 * 3) {
+		render_budget -= render_budget >> 3;
+		if (render_budget < BUDGET_MIN)
+			render_budget = BUDGET_MIN;
+	} else if (render_budget < BUDGET_MAX - BUDGET_STEP) {
+		render_budget += BUDGET_STEP;
+	} else {
+		render_budget = BUDGET_MAX;
 	}
 }
 
 /*
- * Checks whether the space ship is in collision with any of the asteroids,
- * resets the game and reduces the score if so.
+ * Advances the game by one tick on the input gathered since the last one,
+ * recording it. Until a game is started the autopilot plays instead, and
+ * during a playback the input comes from the recording. A player's game
+ * is over when the ship that lost the last life would come back.
  */
-void check_collision() {
-	if (ship.state != VINCIBLE)
+void step() {
+	GameInput in;
+	uint8_t alive = game.ship.state != DEAD;
+	read_input(&in);
+	store_poll();
+	if (splash_ticks) {
+		if (in.pressed || !--splash_ticks) {
+			splash_ticks = 0;
+			attract();
+		}
 		return;
-
-	uint8_t i, j;
-	for (i = 0; i < NO_ASTEROIDS; i++) {
-		for (j = 0; j < SHIP_POINTS; j++) {
-			if (ship.points[j].x > asteroids[i].origin.x
-				&& ship.points[j].x < asteroids[i].origin.x + asteroids[i].size
-				&& ship.points[j].y > asteroids[i].origin.y
-				&& ship.points[j].y < asteroids[i].origin.y + asteroids[i].size) {
-					float angle;
-					uint8_t k;
-					for (k = 0; k < 4; k++) {
-						angle = ((float) rand()/ (float) RAND_MAX)*2*PI;
-						wreckages[k].points[0] = ship.origin;
-						wreckages[k].points[1].x = ship.origin.x + cos(angle)*10;
-						wreckages[k].points[1].y = ship.origin.y + sin(angle)*10;
-						angle = ((float) rand()/ (float) RAND_MAX)*2*PI;
-						wreckages[k].x_inc = cos(angle)*2;
-						wreckages[k].y_inc = sin(angle)*2;
-						wreckage_life = 16;
-					}
-					ship.state = DEAD;
-					score = (score>PENALTY)?score-PENALTY:0;
-					respawn_timer = 0;
-			}
+	}
+	if (game.state == END_STATE) {
+		if ((in.pressed & INPUT_FIRE) || ++end_ticks == END_TICKS)
+			attract();
+		return;
+	}
+	if (playing_back()) {
+		if (!playback_next(&in)) {
+			attract();
+			return;
+		}
+	} else if (game.state == START_STATE) {
+#ifndef SOAK
+		if (in.pressed & (INPUT_FIRE | INPUT_THRUST)) {
+			if (in.pressed & INPUT_FIRE)
+				start_game();
+			else
+				start_playback();
+			return;
 		}
+#endif
+		if (in.pressed || in.turn) {
+			attract_quiet = 0;
+			power_level(POWER_ACTIVE);
+		} else if (attract_quiet < ATTRACT_DIM_TICKS
+				&& ++attract_quiet == ATTRACT_DIM_TICKS) {
+			power_level(POWER_DIM);
+		}
+		adjust_settings(&in);
+		autopilot(&game, &in, stress);
+		if (++soak_ticks == TICKS_PER_MIN) {
+			soak_ticks = 0;
+			soak_minutes++;
+		}
+	} else {
+		if (!lives && alive) {
+			game_over();
+			return;
+		}
+		record_tick(&game, &in);
 	}
+	game_step(&game, &in);
+	if (game.state == PLAY_STATE && !playing_back() && alive
+			&& game.ship.state == DEAD)
+		lives--;
 }
 
-/*
- * Adds an asteroid of a given size at position (x, y), heading in the given 
- * direction with the given speed.
- */ 
-void add_asteroid(float x, float y, float speed, float direction, float size) {
-	asteroids[asteroid_i].origin.x = x;
-	asteroids[asteroid_i].origin.y = y;
-
-	asteroids[asteroid_i].x_inc = speed * cos(direction);
-	asteroids[asteroid_i].y_inc = speed * sin(direction);
-	asteroids[asteroid_i].size = size;
+void init() {	
+	/* 8MHz clock, no prescaling (DS, p. 48) */
+    CLKPR = (1 << CLKPCE);
+    CLKPR = 0;
+
+    init_clock();
+    init_switches();
+    init_rotary();
+    init_telemetry();
 	
-	uint8_t i = 0;
-	while (asteroids[asteroid_i].size != 0) {
-		if (++i > NO_ASTEROIDS)
-			break;
-		asteroid_i = (asteroid_i+1)%NO_ASTEROIDS;
-	}
+	// The panel powers up from timer interrupts while the game is set up.
+	boot_lcd();
+	sei();
+	
+	// Reads first: a read cannot happen while a queued write is going out.
+	seed = eeprom_read_word(&boot_count);
+	init_store();
+	ee_write_word((uint16_t) &boot_count, seed + 1);
+	brightness = store.brightness;
+	frame_rate = store.frame_rate;
+	game_init(&game, seed);
+	game.stress = stress;
+	
+	while (!lcd_up)
+		power_idle();
+	init_power();
+	power_settings(brightness, frame_rate);
+	display_image(splash, 0, 0);
+	
+	/* Configure 16 bit Timer for ISR  */
+    TCCR1B = _BV(WGM12)   /* Clear Timer on Compare match (CTC) Mode */
+           | _BV(CS12)
+           | _BV(CS10);   /* F_CPU / 1024 */
+
+    OCR1A = (uint16_t)(F_CPU * TICK_MS / (1024.0 * 1000)- 0.5);
+
+    TIMSK1 = _BV(OCIE1A); /* enable compare match interrupt */
+    TCNT1 = 0;
 }
 
 /*
- * Adds some 'debris', the dots which scatter when an asteroid is destroided. 
+ * Steps the LCD power-up sequence, rescheduling itself on the clock alarm
+ * for each of the panel's delays.
  */
-void add_debris(float x, float y) {
-	float angle = ((float) rand()/ (float) RAND_MAX)*2*PI;
-	debris[debris_h].x_inc = cos(angle)*5;
-	debris[debris_h].y_inc = sin(angle)*10;
-	debris[debris_h].x = x;
-	debris[debris_h].y = y;
-	debris_h = (debris_h + 1) % NO_DEBRIS;
+void boot_lcd() {
+	uint8_t ms = init_lcd_step();
+	if (ms)
+		clock_alarm(ms, boot_lcd);
+	else
+		lcd_up = 1;
 }
 
 /*
- * Places the ship in the center of the screen, facing up.
+ * Hands over from the attract mode to a player, on a fresh field seeded
+ * from when they pressed.
  */
-void place_ship() {
-	ship.origin.x = 160;
-	ship.origin.y = 120;
-	
-	ship.points[0].x = ship.origin.x-6;
-	ship.points[0].y = ship.origin.y+8;
-	ship.points[1].x = ship.origin.x+6;
-	ship.points[1].y = ship.origin.y+8;
-	ship.points[2].x = ship.origin.x;
-	ship.points[2].y = ship.origin.y-10;
-	ship.points[3].x = ship.origin.x-5;
-	ship.points[3].y = ship.origin.y+5;
-	ship.points[4].x = ship.origin.x+5;
-	ship.points[4].y = ship.origin.y+5;
-	
-	ship.points[5].x = ship.origin.x-3;
-	ship.points[5].y = ship.origin.y+5;
-	ship.points[6].x = ship.origin.x;
-	ship.points[6].y = ship.origin.y+11;
-	ship.points[7].x = ship.origin.x+3;
-	ship.points[7].y = ship.origin.y+5;
-	
-	ship.angle = -PI/2; // Facing up.
-	ship.x_inc = cos(ship.angle);
-	ship.y_inc = sin(ship.angle);
-	ship.x_dec = -ship.y_inc;
-	ship.y_dec = -ship.x_inc;
-	ship.state = INVINCIBLE;
-	ship.horz_v = 0;
-	ship.vert_v = 0;
-	ship.thrusting = 0;
+void start_game() {
+	seed ^= clock_now();
+	game_init(&game, seed);
+	game.state = PLAY_STATE;
+	lives = LIVES;
+	settings_wait = 0;
+	store_settings(brightness, frame_rate);
+	power_level(POWER_ACTIVE);
+	clear_screen();
+	render_reset();
+	record_start(seed, 0);
 }
 
 /*
- *	Draws the space ship.
+ * Replays the game recorded in EEPROM, if there is one.
  */
-void draw_ship() {
-	static uint8_t thrust_frame = 0;
-
-	// Clear last position of ship.
-	draw_line(last_ship.points[0].x, last_ship.points[0].y, last_ship.points[2].x, 
-		last_ship.points[2].y, BLACK);
-	draw_line(last_ship.points[2].x, last_ship.points[2].y, last_ship.points[1].x, 
-		last_ship.points[1].y, BLACK);
-	draw_line(last_ship.points[3].x, last_ship.points[3].y, last_ship.points[4].x, 
-		last_ship.points[4].y, BLACK);
-	draw_line(last_ship.points[5].x, last_ship.points[5].y, 
-		last_ship.points[6].x, last_ship.points[6].y, BLACK);
-	draw_line(last_ship.points[6].x, last_ship.points[6].y, 
-		last_ship.points[7].x, last_ship.points[7].y, BLACK);
-	
-	if (ship.state == DEAD) 
+void start_playback() {
+	uint16_t s;
+	uint8_t flags;
+	if (!playback_start(&s, &flags))
 		return;
-	
-	uint16_t ship_col = ship.state==INVINCIBLE?GREY:WHITE;
-	draw_line(ship.points[0].x, ship.points[0].y, ship.points[2].x, 
-		ship.points[2].y, ship_col);
-	draw_line(ship.points[2].x, ship.points[2].y, ship.points[1].x, 
-		ship.points[1].y, ship_col);
-	draw_line(ship.points[3].x, ship.points[3].y, ship.points[4].x, 
-		ship.points[4].y, ship_col);
-	if (ship.thrusting && thrust_frame) {
-		draw_line(ship.points[5].x, ship.points[5].y, 
-			ship.points[6].x, ship.points[6].y, ship_col);
-		draw_line(ship.points[6].x, ship.points[6].y, 
-			ship.points[7].x, ship.points[7].y, ship_col);
-		thrust_frame = 0;
-	} else {
-		thrust_frame = 1;
-	}
-	
-	last_ship = ship;
+	game_init(&game, s);
+	game.stress = flags & REPLAY_STRESS;
+	game.state = PLAY_STATE;
+	power_level(POWER_ACTIVE);
+	clear_screen();
+	render_reset();
 }
 
 /*
- * Draws all bullets present on the screen.
+ * Ends a player's game: files the score and shows where it came in the
+ * high score table, best first.
  */
-void draw_bullets() {
-	uint8_t i;
-	for (i = bullet_last_l; i != bullet_last_h; i=(i+1)%NO_BULLETS) {
-		draw_pixel(last_bullets[i].x, last_bullets[i].y, BLACK);
-	}
-	
-	for (i = bullet_l; i != bullet_h; i=(i+1)%NO_BULLETS) {
-		draw_pixel(bullets[i].x, bullets[i].y, WHITE);
-	}
-	
-	bullet_last_l = bullet_l;
-	bullet_last_h = bullet_h;
-	for (i = bullet_l; i != bullet_h; i=(i+1)%NO_BULLETS) {
-		last_bullets[i] = bullets[i];
+void game_over() {
+	uint8_t rank, i;
+	record_stop(&game);
+	rank = store_score(game.score);
+	game.state = END_STATE;
+	end_ticks = 0;
+
+	clear_screen();
+	display_color(WHITE, BLACK);
+	display_string_scaled_xy("GAME OVER", 106, 30, 2);
+	display_thing_xy(133, 56, "Score: %d", game.score);
+	for (i = 0; i < NO_HIGH_SCORES; i++) {
+		display_color(i + 1 == rank ? YELLOW : WHITE, BLACK);
+		display_thing_xy(124, 80 + i * 12, "%2d.", i + 1);
+		display_thing_xy(148, 80 + i * 12, "%5d", store.scores[i]);
 	}
 }
 
 /*
- * Draws all debris present on the screen.
+ * Back to the autopilot, on the boot seed.
  */
-void draw_debris() {
-	uint8_t i;
-	for (i = debris_last_l; i != debris_last_h; i=(i+1)%NO_DEBRIS) {
-		draw_pixel(last_debris[i].x, last_debris[i].y, BLACK);
-	}
-	
-	for (i = debris_l; i != debris_h; i=(i+1)%NO_DEBRIS) {
-		draw_pixel(debris[i].x, debris[i].y, WHITE);
-	}
-	
-	debris_last_l = debris_l;
-	debris_last_h = debris_h;
-	for (i = debris_l; i != debris_h; i=(i+1)%NO_DEBRIS) {
-		last_debris[i] = debris[i];
-	}
+void attract() {
+	playback_stop();
+	game_init(&game, seed);
+	game.stress = stress;
+	attract_quiet = 0;
+	clear_screen();
+	render_reset();
+	overlay_stale = 1;
 }
 
 /*
- * Draws all asteroids present on the screen.
+ * In attract mode LEFT and RIGHT dim and brighten the backlight and the
+ * wheel sets the panel refresh. The settings apply at once, and are saved
+ * when left alone for a while rather than at every click.
  */
-void draw_asteroids() {
-	uint8_t i;
-	for (i = 0; i < NO_ASTEROIDS; i++) {
-		if (asteroids[i].size > 0) {
-			asteroids[i].origin.x+=asteroids[i].x_inc;
-			asteroids[i].origin.y+=asteroids[i].y_inc;
-			
-			if (asteroids[i].origin.x > 320)
-				asteroids[i].origin.x = -50;
-			if (asteroids[i].origin.x < -50)
-				asteroids[i].origin.x = 320;
-			if (asteroids[i].origin.y > 240)
-				asteroids[i].origin.y = -50;
-			if (asteroids[i].origin.y < -50)
-				asteroids[i].origin.y = 240;
-		}
-	}
-	
-	for (i = 0; i < NO_ASTEROIDS; i++) {
-		if (last_asteroids[i].size > 0)
-			draw_outline_rectangle(last_asteroids[i].origin.x, 
-			last_asteroids[i].origin.y, 
-				last_asteroids[i].size, last_asteroids[i].size, BLACK);
-		else
-			draw_outline_rectangle(last_asteroids[i].origin.x, 
-			last_asteroids[i].origin.y, 
-				SMALL_SIZE, SMALL_SIZE, BLACK);			
-	}
-	
-	for (i = 0; i < NO_ASTEROIDS; i++)
-		if (asteroids[i].size > 0)
-			draw_outline_rectangle(asteroids[i].origin.x, asteroids[i].origin.y, 
-				asteroids[i].size, asteroids[i].size, WHITE);
-
-	for (i = 0; i < NO_ASTEROIDS; i++) {
-		last_asteroids[i] = asteroids[i];
+void adjust_settings(const GameInput *in) {
+	uint8_t b = brightness;
+	int16_t f = frame_rate + in->turn * FRAME_RATE_STEP;
+	if ((in->pressed & INPUT_LEFT) && b > BRIGHTNESS_STEP)
+		b -= BRIGHTNESS_STEP;
+	if (in->pressed & INPUT_RIGHT)
+		b = b < 255 - BRIGHTNESS_STEP ? b + BRIGHTNESS_STEP : 255;
+	if (f < FRAME_RATE_MIN)
+		f = FRAME_RATE_MIN;
+	if (f > FRAME_RATE_MAX)
+		f = FRAME_RATE_MAX;
+
+	if (b != brightness || f != frame_rate) {
+		brightness = b;
+		frame_rate = f;
+		power_settings(brightness, frame_rate);
+		settings_wait = SETTINGS_SAVE_TICKS;
+		overlay_stale = 1;
+	} else if (settings_wait && !--settings_wait) {
+		store_settings(brightness, frame_rate);
 	}
 }
 
 /*
- * Draws all wreckage present on the screen.
+ * Reads the switches and the rotary encoder into this tick's game input,
+ * stamping the presses the latency histogram follows.
  */
-void draw_wreckage() {
-	if (ship.state != DEAD) 
-		return;
-
-	uint8_t i;
-	for (i = 0; i < 4; i++) {
-		draw_line(last_wreckages[i].points[0].x, last_wreckages[i].points[0].y,
-				last_wreckages[i].points[1].x, last_wreckages[i].points[1].y, BLACK);
+void read_input(GameInput *in) {
+	uint8_t b;
+	in->held = 0;
+	in->pressed = 0;
+	for (b = 0; b < NO_BUTTONS; b++) {
+		if (switch_held(b))
+			in->held |= _BV(b);
+		if (switch_pressed(b))
+			in->pressed |= _BV(b);
 	}
+	in->turn = rotary_delta();
 
-	if (wreckage_life == 0) 
+	if (game.ship.state == DEAD || game.state != PLAY_STATE)
 		return;
-
-	for (i = 0; i < 4; i++) {
-		draw_line(wreckages[i].points[0].x, wreckages[i].points[0].y,
-			wreckages[i].points[1].x, wreckages[i].points[1].y, WHITE);
-		last_wreckages[i] = wreckages[i];
-	}	
-	
-	wreckage_life--;
+	if (in->pressed & INPUT_FIRE)
+		latency_stamp(LAT_FIRE, switch_press_us(BTN_CENTER));
+	if (switch_pressed(BTN_UP))
+		latency_stamp(LAT_SHIP, switch_press_us(BTN_UP));
+	if (switch_pressed(BTN_LEFT))
+		latency_stamp(LAT_SHIP, switch_press_us(BTN_LEFT));
+	if (switch_pressed(BTN_RIGHT))
+		latency_stamp(LAT_SHIP, switch_press_us(BTN_RIGHT));
 }
 
 /*
  * Draws the game on the screen
  */
 void draw() {
-	display_thing_xy(10, 10, "Score: %d", score);
-	draw_wreckage();
-	draw_debris();
-	draw_ship();
-	draw_bullets();
-	draw_asteroids();
-	check_collision();
-}
-
-/*
- * Handles the player input.
- */
-void handle_input() {
-	if (center_pressed() && ship.state != DEAD) {
-		bullets[bullet_h].x_inc = cos(ship.angle)*10;
-		bullets[bullet_h].y_inc = sin(ship.angle)*10 ;
-		bullets[bullet_h].x = ship.origin.x+bullets[bullet_h].x_inc;
-		bullets[bullet_h].y = ship.origin.y+bullets[bullet_h].y_inc;
-		bullet_h = (bullet_h + 1) % NO_BULLETS;
-	}
-	if (right_held() && ship.state != DEAD)
-		rotate_ship(TURN_ANGLE);
-	if (left_held() && ship.state != DEAD)
-		rotate_ship(-TURN_ANGLE);
-	if (up_held() && ship.state != DEAD) {
-		ship.horz_v += SHIP_ACCELERATION*ship.x_inc;
-		ship.vert_v += SHIP_ACCELERATION*ship.y_inc;
-		ship.thrusting = 1;
-	} else {
-		ship.thrusting = 0;
-	}
-		
-	float decel_angle = (ship.horz_v==0)?((ship.vert_v>0)?1.570896327:-1.570896327):atan(ship.vert_v/ship.horz_v);
-	if (ship.horz_v < 0)
-		decel_angle -= 3.14159265;
-	float decel_hoz = cos(decel_angle + 3.14159265)*SHIP_DECELERATION;
-	float decel_vert = sin(decel_angle + 3.14159265)*SHIP_DECELERATION;
-	
-	if (fabs(ship.horz_v) > fabs(decel_hoz))
-		ship.horz_v += decel_hoz;
-	else
-		ship.horz_v = 0;
-		
-	if (fabs(ship.vert_v) > fabs(decel_vert))
-		ship.vert_v += decel_vert;
-	else
-		ship.vert_v = 0;
-
-	thrust_ship();
-}
-
-/*
- * Adds new asteroids to the game if there is space. The fully split asteroid
- * should not lead to more asteroids on screen than NO_ASTEROIDS.
- */
-uint16_t pot_asteroids = 0; // Potential asteroids.
-void gen_asteroids() {
-	if (pot_asteroids < NO_ASTEROIDS-3) {
-		uint16_t rnd = rand();
-		add_asteroid(-30, -30, 3, ((float) rnd/ (float) RAND_MAX)*6, BIG_SIZE);
-		pot_asteroids+=4;
+#ifdef FRAME_STATS
+	TRACE_BEGIN(TR_DRAW_HUD);
+	display_thing_xy(10, 220, "Missed: %d ", missed_ticks);
+	display_thing_xy(100, 220, "Worst: %dms ",
+		(uint16_t) (((uint32_t) worst_frame * 1024000) / F_CPU));
+	display_thing_xy(200, 220, "Budget: %d ", render_budget);
+	display_thing_xy(10, 230, "Idle: %d%% ", idle_percent);
+	display_thing_xy(100, 230, "Boot: %dms ", first_frame_ms);
+	display_thing_xy(200, 230, "Input: %dus ", input_latency_max);
+	display_thing_xy(10, 210, "Lat p50: %d ", latency_percentile_ms(50));
+	display_thing_xy(100, 210, "p99: %d ", latency_percentile_ms(99));
+	display_thing_xy(200, 210, "max: %dms ", latency_max_us / 1000);
+	display_thing_xy(10, 200, "Stack: %d ", stack_high_water());
+	display_thing_xy(100, 200, "of %d ", stack_size());
+	TRACE_END(TR_DRAW_HUD);
+#endif
+	if (game.state == END_STATE || splash_ticks)
+		return;
+	if (game.state == START_STATE)
+		draw_soak();
+	else if (game.tick % TICKS_PER_SEC == 0) {
+		display_color(WHITE, BLACK);
+		if (playing_back())
+			display_string_xy("REPLAY", 284, 10);
+		else
+			display_thing_xy(250, 10, "Lives: %d", lives);
 	}
+	render(&game);
 }
 
 /*
- * Updates the state of the game.
+ * Shows the attract mode's run time, worst frame and missed ticks, the
+ * best score and the settings, once a second so the soak log costs little
+ * of the frame it is measuring.
  */
-void update() {
-	// Brief period of invincibility.
-	if (ship.state == INVINCIBLE && ++inv_timer>32) {
-		ship.state = VINCIBLE;
-		inv_timer = 0;
-	} else if (ship.state == DEAD && ++respawn_timer>32) {
-		ship.state = INVINCIBLE;
-		respawn_timer = 0;
-		inv_timer = 0;
-		place_ship();
-	}
-
-	uint8_t i, j;
-	if (bullet_h - bullet_l != 0) {
-		for (i = bullet_l; i != bullet_h; i=(i+1)%NO_BULLETS) {
-			bullets[i].x+=bullets[i].x_inc;
-			bullets[i].y+=bullets[i].y_inc;
-			for (j = 0; j < NO_ASTEROIDS; j++) {
-				// Checks if the bullets are in collision with asteroids by
-				// checking the current position of the bullet and the 
-				// half-way point between there and its last position (for
-				// collision accuracy) 
-				if (asteroids[j].size > 0 &&
-						((bullets[i].x > asteroids[j].origin.x && 
-						bullets[i].x < asteroids[j].origin.x + asteroids[j].size &&
-						bullets[i].y > asteroids[j].origin.y &&
-						bullets[i].y < asteroids[j].origin.y + asteroids[j].size) 
-						|| (bullets[i].x-bullets[i].x_inc/2 > asteroids[j].origin.x && 
-						bullets[i].x-bullets[i].x_inc/2 < asteroids[j].origin.x + asteroids[j].size &&
-						bullets[i].y-bullets[i].y_inc/2 > asteroids[j].origin.y &&
-						bullets[i].y-bullets[i].y_inc/2 < asteroids[j].origin.y + asteroids[j].size))) {
-					if (asteroids[j].size == BIG_SIZE) {
-						asteroids[j].size = 0;
-						add_asteroid(asteroids[j].origin.x, 
-							asteroids[j].origin.y, 5, ((float) rand()/ (float) RAND_MAX)*2*PI, MID_SIZE);
-						add_asteroid(asteroids[j].origin.x, 
-							asteroids[j].origin.y, 5, ((float) rand()/ (float) RAND_MAX)*2*PI, MID_SIZE);
-					}
-					else if (asteroids[j].size == MID_SIZE) {
-						asteroids[j].size = 0;
-						add_asteroid(asteroids[j].origin.x, 
-							asteroids[j].origin.y, 5, ((float) rand()/ (float) RAND_MAX)*2*PI, SMALL_SIZE);
-						add_asteroid(asteroids[j].origin.x, 
-							asteroids[j].origin.y, 5, ((float) rand()/ (float) RAND_MAX)*2*PI, SMALL_SIZE);
-					} else {
-						asteroids[j].size = 0;
-						pot_asteroids--;
-					}
-						
-					bullet_l = (bullet_l+1)%NO_BULLETS;
-					add_debris(asteroids[j].origin.x, asteroids[j].origin.y);
-					add_debris(asteroids[j].origin.x, asteroids[j].origin.y);
-					add_debris(asteroids[j].origin.x, asteroids[j].origin.y);
-					add_debris(asteroids[j].origin.x, asteroids[j].origin.y);
-					add_debris(asteroids[j].origin.x, asteroids[j].origin.y);
-					
-					score++;
-					break;
-				} 
-			}
-			
-			if (bullets[i].x > 320 || bullets[i].y > 240)
-				bullet_l = (bullet_l+1)%NO_BULLETS;
-		}
-	}
-	
-	for (i = debris_l; i != debris_h; i=(i+1)%NO_DEBRIS) {
-			debris[i].x+=debris[i].x_inc;
-			debris[i].y+=debris[i].y_inc;
-			
-			if (debris[i].x > 320 || debris[i].y > 240)
-				debris_l = (debris_l+1)%NO_DEBRIS;
-	}
-	
-	if (wreckage_life > 0) {
-		for (i = 0; i < 4; i++) {
-				wreckages[i].points[0].x+=wreckages[i].x_inc;
-				wreckages[i].points[0].y+=wreckages[i].y_inc;
-				wreckages[i].points[1].x+=wreckages[i].x_inc;
-				wreckages[i].points[1].y+=wreckages[i].y_inc;
-		}
-	}
+void draw_soak() {
+	if (soak_ticks % TICKS_PER_SEC && !overlay_stale)
+		return;
+	overlay_stale = 0;
+	TRACE_BEGIN(TR_DRAW_HUD);
+	display_color(WHITE, BLACK);
+	display_string_xy(stress ? "STRESS   " : "AUTOPILOT", 260, 10);
+	display_thing_xy(10, 22, "Up: %dmin ", soak_minutes);
+	display_thing_xy(100, 22, "Worst: %dms ",
+		(uint16_t) (((uint32_t) worst_frame * 1024000) / F_CPU));
+	display_thing_xy(200, 22, "Missed: %d ", missed_ticks);
+	display_thing_xy(10, 34, "Best: %d ", store.scores[0]);
+	display_thing_xy(100, 34, "Light: %d ", brightness);
+	display_thing_xy(200, 34, "Rate: %dHz ", frame_rate);
+	TRACE_END(TR_DRAW_HUD);
 }
-
-
-
-
@@ -0,0 +1,64 @@
+#include "autopilot.h"
+#include <math.h>
+
+/*
+ * Fills in one tick of input for g. In stress mode it fires whenever the
+ * bullet ring has room, aimed or not, to keep it full.
+ */
+void autopilot(const Game *g, GameInput *in, uint8_t stress) {
+	const Ship *ship = &g->ship;
+	const Asteroid *nearest = 0;
+	float best = 0, dx = 0, dy = 0;
+	uint8_t i, fire = 0;
+
+	in->held = 0;
+	in->pressed = 0;
+	in->turn = 0;
+	if (ship->state == DEAD)
+		return;
+
+	for (i = 0; i < NO_ASTEROIDS; i++) {
+		const Asteroid *a = &g->asteroids[i];
+		if (a->size == 0)
+			continue;
+		float x = a->origin.x + a->size / 2 - ship->origin.x;
+		float y = a->origin.y + a->size / 2 - ship->origin.y;
+		float d = x * x + y * y;
+		if (!nearest || d < best) {
+			nearest = a;
+			best = d;
+			dx = x;
+			dy = y;
+		}
+	}
+
+	float want = ship->angle;
+	if (nearest) {
+		float reach = nearest->size / 2 + AUTOPILOT_DANGER;
+		want = atan2(dy, dx);
+		if (best < reach * reach) {
+			// Too close: face away from it and run.
+			want += PI;
+			in->held |= INPUT_THRUST;
+		} else {
+			fire = 1;
+		}
+	}
+
+	float off = fmod(want - ship->angle, 2 * PI);
+	if (off > PI)
+		off -= 2 * PI;
+	else if (off < -PI)
+		off += 2 * PI;
+	if (off > TURN_ANGLE / 2)
+		in->held |= INPUT_RIGHT;
+	else if (off < -TURN_ANGLE / 2)
+		in->held |= INPUT_LEFT;
+	if ((in->held & INPUT_THRUST) && fabs(off) > PI / 2)
+		in->held &= ~INPUT_THRUST; // Not until it is facing away.
+
+	// Firing every tick laps the bullet ring, so only fire into a free slot.
+	if (game_bullets(g) < NO_BULLETS - 1
+			&& (stress || (fire && fabs(off) < AUTOPILOT_AIM)))
+		in->pressed |= INPUT_FIRE;
+}
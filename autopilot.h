@@ -0,0 +1,13 @@
+/*
+ * Plays the game on its own: turns to the nearest asteroid and shoots it,
+ * and turns away and thrusts when one gets too close. Drives the attract
+ * mode and the burn-in soak.
+ */
+
+#include <stdint.h>
+#include "game.h"
+
+#define AUTOPILOT_DANGER 30 // Clearance from an asteroid's edge to run at.
+#define AUTOPILOT_AIM 0.25  // Radians off target it still fires at.
+
+void autopilot(const Game *g, GameInput *in, uint8_t stress);
@@ -0,0 +1,73 @@
+#include "clock.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#define US_PER_COUNT (8000000UL / F_CPU)
+
+volatile uint16_t clock_hi = 0;
+
+void (*alarm_fn)();
+volatile uint16_t alarm_ms;
+
+void init_clock() {
+	TCCR3A = 0;
+	TCCR3B = _BV(CS31); /* F_CPU / 8, normal mode */
+	TCNT3 = 0;
+	TIMSK3 = _BV(TOIE3);
+}
+
+ISR(TIMER3_OVF_vect) {
+	clock_hi++;
+}
+
+/*
+ * Low 16 bits of the clock; wraps every 65ms but is cheap enough for
+ * timestamping inside interrupts. The tick reads it with interrupts on, and
+ * an interrupt reading TCNT3 between its two bytes would spoil the high
+ * byte latched for it, so the read is atomic.
+ */
+uint16_t clock_now() {
+	uint16_t t;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		t = TCNT3;
+	}
+	return t * US_PER_COUNT;
+}
+
+/*
+ * Microseconds since init_clock(), good for about 71 minutes.
+ */
+uint32_t clock_us() {
+	uint16_t hi, lo;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		hi = clock_hi;
+		lo = TCNT3;
+		// Overflow pending but not yet serviced.
+		if ((TIFR3 & _BV(TOV3)) && lo < 0x8000)
+			hi++;
+	}
+	return (((uint32_t) hi << 16) | lo) * US_PER_COUNT;
+}
+
+/*
+ * Calls fn from interrupt context after ms milliseconds. Only one alarm can
+ * be pending; a new one replaces the old.
+ */
+void clock_alarm(uint16_t ms, void (*fn)()) {
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		alarm_fn = fn;
+		alarm_ms = ms;
+		OCR3B = TCNT3 + 1000 / US_PER_COUNT;
+		TIFR3 = _BV(OCF3B);
+		TIMSK3 |= _BV(OCIE3B);
+	}
+}
+
+ISR(TIMER3_COMPB_vect) {
+	OCR3B += 1000 / US_PER_COUNT;
+	if (--alarm_ms == 0) {
+		TIMSK3 &= ~_BV(OCIE3B);
+		alarm_fn();
+	}
+}
@@ -0,0 +1,11 @@
+/*
+ * Free-running microsecond clock on TIMER3 (F_CPU / 8), plus a one-shot
+ * millisecond alarm on its compare B channel.
+ */
+
+#include <stdint.h>
+
+void init_clock();
+uint16_t clock_now();
+uint32_t clock_us();
+void clock_alarm(uint16_t ms, void (*fn)());
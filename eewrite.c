@@ -0,0 +1,64 @@
+#include "eewrite.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+struct {
+	uint16_t addr;
+	uint8_t b;
+} ee_queue[EE_QUEUE];
+volatile uint8_t ee_head = 0;
+volatile uint8_t ee_len = 0;
+
+/*
+ * Queues a byte for writing. Callers check ee_room() first; a byte that
+ * does not fit is dropped.
+ */
+void ee_write(uint16_t addr, uint8_t b) {
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		if (ee_len < EE_QUEUE) {
+			uint8_t i = ee_head + ee_len;
+			if (i >= EE_QUEUE)
+				i -= EE_QUEUE;
+			ee_queue[i].addr = addr;
+			ee_queue[i].b = b;
+			ee_len++;
+			EECR |= _BV(EERIE);
+		}
+	}
+}
+
+void ee_write_word(uint16_t addr, uint16_t w) {
+	ee_write(addr, w);
+	ee_write(addr + 1, w >> 8);
+}
+
+uint8_t ee_room() {
+	return EE_QUEUE - ee_len;
+}
+
+/*
+ * True when nothing is queued or being written, so a read will not have
+ * to wait.
+ */
+uint8_t ee_idle() {
+	return ee_len == 0 && !(EECR & _BV(EEPE));
+}
+
+/*
+ * Fires whenever the EEPROM is ready for another byte; starts the next
+ * write, or goes quiet when the queue is empty.
+ */
+ISR(EE_READY_vect) {
+	if (ee_len == 0) {
+		EECR &= ~_BV(EERIE);
+		return;
+	}
+	EEAR = ee_queue[ee_head].addr;
+	EEDR = ee_queue[ee_head].b;
+	EECR |= _BV(EEMPE);
+	EECR |= _BV(EEPE);
+	if (++ee_head == EE_QUEUE)
+		ee_head = 0;
+	ee_len--;
+}
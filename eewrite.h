@@ -0,0 +1,14 @@
+/*
+ * Queued EEPROM writes, clocked out by the EE_READY interrupt so nothing
+ * waits for the 3.4ms each byte takes. Every EEPROM write in the game goes
+ * through here.
+ */
+
+#include <stdint.h>
+
+#define EE_QUEUE 64
+
+void ee_write(uint16_t addr, uint8_t b);
+void ee_write_word(uint16_t addr, uint16_t w);
+uint8_t ee_room();
+uint8_t ee_idle();
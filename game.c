@@ -0,0 +1,532 @@
+#include "game.h"
+#include <math.h>
+#include "trace.h"
+#ifdef GAME_COLLIDE
+#include "collide.h"
+#endif
+
+void rotate_ship(Game *g, float angle);
+void thrust_ship(Game *g);
+void handle_input(Game *g, const GameInput *in);
+void update(Game *g);
+void check_collision(Game *g);
+void wreck_ship(Game *g);
+void hit_asteroid(Game *g, Asteroid *a);
+void gen_asteroids(Game *g);
+void place_ship(Game *g);
+void add_asteroid(Game *g, float x, float y, float speed, float direction,
+	float size);
+void add_debris(Game *g, float x, float y);
+
+/*
+ * Starts a new game. The same seed always plays out the same way for the
+ * same input.
+ */
+void game_init(Game *g, uint16_t seed) {
+	uint8_t i;
+
+	g->state = START_STATE;
+	g->stress = 0;
+	g->score = 0;
+	g->tick = 0;
+	g->rng = seed;
+
+	place_ship(g);
+	g->inv_timer = 0;
+	g->respawn_timer = 0;
+
+	g->bullet_l = 0;
+	g->bullet_h = 0;
+	g->debris_l = 0;
+	g->debris_h = 0;
+
+	for (i = 0; i <= NO_ASTEROIDS; i++)
+		g->asteroids[i].size = 0;
+	g->asteroid_i = 0;
+	g->pot_asteroids = 0;
+	g->a_timer = ASTEROID_PERIOD;
+
+	g->wreckage_life = 0;
+#ifdef GAME_STATS
+	g->collision_tests = 0;
+#endif
+}
+
+/*
+ * Advances the game by one tick.
+ */
+void game_step(Game *g, const GameInput *in) {
+	if (g->a_timer == 0 || g->stress) {
+		gen_asteroids(g);
+		g->a_timer = ASTEROID_PERIOD;
+	}
+
+	TRACE_BEGIN(TR_INPUT);
+	handle_input(g, in);
+	TRACE_END(TR_INPUT);
+	TRACE_BEGIN(TR_UPDATE);
+	update(g);
+	TRACE_END(TR_UPDATE);
+
+	g->a_timer--;
+	g->tick++;
+}
+
+/*
+ * The game's own random numbers, 0 to GAME_RAND_MAX, so that a run depends
+ * only on its seed and not on the C library it was built against.
+ */
+uint16_t game_rand(Game *g) {
+	g->rng = g->rng * 1103515245 + 12345;
+	return (g->rng >> 16) & GAME_RAND_MAX;
+}
+
+static float random_angle(Game *g) {
+	return ((float) game_rand(g) / (float) GAME_RAND_MAX)*2*PI;
+}
+
+uint8_t game_asteroids(const Game *g) {
+	uint8_t i, n = 0;
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		if (g->asteroids[i].size > 0)
+			n++;
+	return n;
+}
+
+uint8_t game_bullets(const Game *g) {
+	return (g->bullet_h + NO_BULLETS - g->bullet_l) % NO_BULLETS;
+}
+
+uint8_t game_debris(const Game *g) {
+	return (g->debris_h + NO_DEBRIS - g->debris_l) % NO_DEBRIS;
+}
+
+#ifdef GAME_STATS
+static uint32_t fnv(const void *p, uint8_t n, uint32_t h) {
+	const uint8_t *b = p;
+	while (n--)
+		h = (h ^ *b++) * 16777619u;
+	return h;
+}
+
+/*
+ * FNV-1a over the score, the generator and where everything is. Two runs
+ * that agree on it have played out the same.
+ */
+uint32_t game_hash(const Game *g) {
+	uint32_t h = 2166136261u;
+	uint8_t i;
+	h = fnv(&g->score, sizeof(g->score), h);
+	h = fnv(&g->rng, sizeof(g->rng), h);
+	h = fnv(&g->ship.origin, sizeof(g->ship.origin), h);
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		h = fnv(&g->asteroids[i].origin, sizeof(Point), h);
+	return h;
+}
+#endif
+
+/*
+ * Rotates the point p about the point o.
+ */
+Point rotate_point (float sin_res, float cos_res, Point p, Point o) {
+	float x = p.x - o.x;
+	float y = p.y - o.y;
+	float x_rot = x * cos_res - y * sin_res;
+	float y_rot = x * sin_res + y * cos_res;
+
+	p.x = x_rot + o.x;
+	p.y = y_rot + o.y;
+
+	return p;
+}
+
+/*
+ * Rotates the space ship by the given angle.
+ */
+void rotate_ship (Game *g, float angle) {
+	Ship *ship = &g->ship;
+	float sin_result = sin(angle);
+	float cos_result = cos(angle);
+
+	ship->angle += angle;
+
+	uint8_t i;
+	for (i = 0; i < SHIP_POINTS; i++)
+		ship->points[i] =
+			rotate_point(sin_result, cos_result, ship->points[i], ship->origin);
+
+	ship->x_inc = cos(ship->angle);
+	ship->y_inc = sin(ship->angle);
+	ship->x_dec = cos(ship->angle-3.14159265);
+	ship->y_dec = sin(ship->angle-3.14159265);
+}
+
+/*
+ *	Thrusts the space ship in the direction it is facing.
+ */
+void thrust_ship(Game *g) {
+	Ship *ship = &g->ship;
+	uint8_t i;
+	for (i = 0; i < SHIP_POINTS; i++) {
+		ship->points[i].x += ship->horz_v;
+		ship->points[i].y += ship->vert_v;
+	}
+	ship->origin.x += ship->horz_v;
+	ship->origin.y += ship->vert_v;
+
+	// Wrap-around
+	if (ship->origin.x > 350) {
+		ship->origin.x -= 400;
+		for (i = 0; i < SHIP_POINTS; i++)
+			ship->points[i].x -= 400;
+	}
+	if (ship->origin.x < -30) {
+		ship->origin.x += 400;
+		for (i = 0; i < SHIP_POINTS; i++)
+			ship->points[i].x += 400;
+	}
+	if (ship->origin.y > 270) {
+		ship->origin.y -= 320;
+		for (i = 0; i < SHIP_POINTS; i++)
+			ship->points[i].y -= 320;
+	}
+	if (ship->origin.y < -30) {
+		ship->origin.y += 320;
+		for (i = 0; i < SHIP_POINTS; i++)
+			ship->points[i].y += 320;
+	}
+}
+
+/*
+ * Checks whether the space ship is in collision with any of the asteroids,
+ * resets the game and reduces the score if so.
+ */
+void check_collision(Game *g) {
+	Ship *ship = &g->ship;
+	if (ship->state != VINCIBLE)
+		return;
+
+	uint8_t i, j;
+#ifdef GAME_STATS
+	g->collision_tests += NO_ASTEROIDS * SHIP_POINTS;
+#endif
+#ifdef GAME_COLLIDE
+	Boxes boxes;
+	uint16_t hits[SHIP_POINTS];
+	collide_load(&boxes, g->asteroids, NO_ASTEROIDS);
+	for (j = 0; j < SHIP_POINTS; j++)
+		hits[j] = collide(&boxes, ship->points[j].x, ship->points[j].y);
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		for (j = 0; j < SHIP_POINTS; j++)
+			if (hits[j] & 1 << i)
+				wreck_ship(g);
+#else
+	for (i = 0; i < NO_ASTEROIDS; i++) {
+		Asteroid *a = &g->asteroids[i];
+		for (j = 0; j < SHIP_POINTS; j++) {
+			if (ship->points[j].x > a->origin.x
+				&& ship->points[j].x < a->origin.x + a->size
+				&& ship->points[j].y > a->origin.y
+				&& ship->points[j].y < a->origin.y + a->size)
+					wreck_ship(g);
+		}
+	}
+#endif
+}
+
+/*
+ * Breaks the ship up into wreckage and takes the penalty off the score.
+ */
+void wreck_ship(Game *g) {
+	Ship *ship = &g->ship;
+	float angle;
+	uint8_t k;
+	for (k = 0; k < NO_WRECKAGE; k++) {
+		Wreckage *w = &g->wreckages[k];
+		angle = random_angle(g);
+		w->points[0] = ship->origin;
+		w->points[1].x = ship->origin.x + cos(angle)*10;
+		w->points[1].y = ship->origin.y + sin(angle)*10;
+		angle = random_angle(g);
+		w->x_inc = cos(angle)*2;
+		w->y_inc = sin(angle)*2;
+		g->wreckage_life = 16;
+	}
+	ship->state = DEAD;
+	g->score = (g->score>PENALTY)?g->score-PENALTY:0;
+	g->respawn_timer = 0;
+}
+
+/*
+ * Adds an asteroid of a given size at position (x, y), heading in the given
+ * direction with the given speed.
+ */
+void add_asteroid(Game *g, float x, float y, float speed, float direction,
+		float size) {
+	Asteroid *a = &g->asteroids[g->asteroid_i];
+	a->origin.x = x;
+	a->origin.y = y;
+
+	a->x_inc = speed * cos(direction);
+	a->y_inc = speed * sin(direction);
+	a->size = size;
+
+	uint8_t i = 0;
+	while (g->asteroids[g->asteroid_i].size != 0) {
+		if (++i > NO_ASTEROIDS)
+			break;
+		g->asteroid_i = (g->asteroid_i+1)%NO_ASTEROIDS;
+	}
+}
+
+/*
+ * Adds some 'debris', the dots which scatter when an asteroid is destroided.
+ */
+void add_debris(Game *g, float x, float y) {
+	Shrapnel *d = &g->debris[g->debris_h];
+	float angle = random_angle(g);
+	d->x_inc = cos(angle)*5;
+	d->y_inc = sin(angle)*10;
+	d->x = x;
+	d->y = y;
+	g->debris_h = (g->debris_h + 1) % NO_DEBRIS;
+}
+
+/*
+ * Places the ship in the center of the screen, facing up.
+ */
+void place_ship(Game *g) {
+	Ship *ship = &g->ship;
+	ship->origin.x = 160;
+	ship->origin.y = 120;
+
+	ship->points[0].x = ship->origin.x-6;
+	ship->points[0].y = ship->origin.y+8;
+	ship->points[1].x = ship->origin.x+6;
+	ship->points[1].y = ship->origin.y+8;
+	ship->points[2].x = ship->origin.x;
+	ship->points[2].y = ship->origin.y-10;
+	ship->points[3].x = ship->origin.x-5;
+	ship->points[3].y = ship->origin.y+5;
+	ship->points[4].x = ship->origin.x+5;
+	ship->points[4].y = ship->origin.y+5;
+
+	ship->points[5].x = ship->origin.x-3;
+	ship->points[5].y = ship->origin.y+5;
+	ship->points[6].x = ship->origin.x;
+	ship->points[6].y = ship->origin.y+11;
+	ship->points[7].x = ship->origin.x+3;
+	ship->points[7].y = ship->origin.y+5;
+
+	ship->angle = -PI/2; // Facing up.
+	ship->x_inc = cos(ship->angle);
+	ship->y_inc = sin(ship->angle);
+	ship->x_dec = -ship->y_inc;
+	ship->y_dec = -ship->x_inc;
+	ship->state = INVINCIBLE;
+	ship->horz_v = 0;
+	ship->vert_v = 0;
+	ship->thrusting = 0;
+}
+
+/*
+ * Handles the player input.
+ */
+void handle_input(Game *g, const GameInput *in) {
+	Ship *ship = &g->ship;
+	if ((in->pressed & INPUT_FIRE) && ship->state != DEAD) {
+		Bullet *b = &g->bullets[g->bullet_h];
+		b->x_inc = cos(ship->angle)*10;
+		b->y_inc = sin(ship->angle)*10 ;
+		b->x = ship->origin.x+b->x_inc;
+		b->y = ship->origin.y+b->y_inc;
+		g->bullet_h = (g->bullet_h + 1) % NO_BULLETS;
+	}
+	if ((in->held & INPUT_RIGHT) && ship->state != DEAD)
+		rotate_ship(g, TURN_ANGLE);
+	if ((in->held & INPUT_LEFT) && ship->state != DEAD)
+		rotate_ship(g, -TURN_ANGLE);
+	if (in->turn && ship->state != DEAD)
+		rotate_ship(g, in->turn * ROTARY_ANGLE);
+	if ((in->held & INPUT_THRUST) && ship->state != DEAD) {
+		ship->horz_v += SHIP_ACCELERATION*ship->x_inc;
+		ship->vert_v += SHIP_ACCELERATION*ship->y_inc;
+		ship->thrusting = 1;
+	} else {
+		ship->thrusting = 0;
+	}
+
+	float decel_angle = (ship->horz_v==0)?((ship->vert_v>0)?1.570896327:-1.570896327):atan(ship->vert_v/ship->horz_v);
+	if (ship->horz_v < 0)
+		decel_angle -= 3.14159265;
+	float decel_hoz = cos(decel_angle + 3.14159265)*SHIP_DECELERATION;
+	float decel_vert = sin(decel_angle + 3.14159265)*SHIP_DECELERATION;
+
+	if (fabs(ship->horz_v) > fabs(decel_hoz))
+		ship->horz_v += decel_hoz;
+	else
+		ship->horz_v = 0;
+
+	if (fabs(ship->vert_v) > fabs(decel_vert))
+		ship->vert_v += decel_vert;
+	else
+		ship->vert_v = 0;
+
+	thrust_ship(g);
+}
+
+/*
+ * Adds new asteroids to the game if there is space. The fully split asteroid
+ * should not lead to more asteroids on screen than NO_ASTEROIDS.
+ */
+void gen_asteroids(Game *g) {
+	if (g->pot_asteroids < NO_ASTEROIDS-3) {
+		uint16_t rnd = game_rand(g);
+		add_asteroid(g, -30, -30, 3, ((float) rnd/ (float) GAME_RAND_MAX)*6,
+			BIG_SIZE);
+		g->pot_asteroids+=4;
+	}
+}
+
+/*
+ * Splits or destroys an asteroid a bullet has hit, using up the oldest
+ * bullet.
+ */
+void hit_asteroid(Game *g, Asteroid *a) {
+	if (a->size == BIG_SIZE) {
+		a->size = 0;
+		add_asteroid(g, a->origin.x, a->origin.y, 5,
+			random_angle(g), MID_SIZE);
+		add_asteroid(g, a->origin.x, a->origin.y, 5,
+			random_angle(g), MID_SIZE);
+	}
+	else if (a->size == MID_SIZE) {
+		a->size = 0;
+		add_asteroid(g, a->origin.x, a->origin.y, 5,
+			random_angle(g), SMALL_SIZE);
+		add_asteroid(g, a->origin.x, a->origin.y, 5,
+			random_angle(g), SMALL_SIZE);
+	} else {
+		a->size = 0;
+		g->pot_asteroids--;
+	}
+
+	g->bullet_l = (g->bullet_l+1)%NO_BULLETS;
+	add_debris(g, a->origin.x, a->origin.y);
+	add_debris(g, a->origin.x, a->origin.y);
+	add_debris(g, a->origin.x, a->origin.y);
+	add_debris(g, a->origin.x, a->origin.y);
+	add_debris(g, a->origin.x, a->origin.y);
+
+	g->score++;
+}
+
+/*
+ * Updates the state of the game.
+ */
+void update(Game *g) {
+	Ship *ship = &g->ship;
+	// Brief period of invincibility.
+	if (ship->state == INVINCIBLE && ++g->inv_timer>32) {
+		ship->state = VINCIBLE;
+		g->inv_timer = 0;
+	} else if (ship->state == DEAD && ++g->respawn_timer>32) {
+		ship->state = INVINCIBLE;
+		g->respawn_timer = 0;
+		g->inv_timer = 0;
+		place_ship(g);
+	}
+
+	uint8_t i, j;
+#ifdef GAME_COLLIDE
+	Boxes boxes;
+	collide_load(&boxes, g->asteroids, NO_ASTEROIDS);
+#endif
+	if (g->bullet_h - g->bullet_l != 0) {
+		for (i = g->bullet_l; i != g->bullet_h; i=(i+1)%NO_BULLETS) {
+			Bullet *b = &g->bullets[i];
+			b->x+=b->x_inc;
+			b->y+=b->y_inc;
+#ifdef GAME_COLLIDE
+			// Same rule as below, all asteroids at once; the lowest hit wins.
+			uint16_t hits = boxes.live
+				& (collide(&boxes, b->x, b->y)
+				| collide(&boxes, b->x-b->x_inc/2, b->y-b->y_inc/2));
+			j = hits ? __builtin_ctz(hits) : NO_ASTEROIDS;
+#ifdef GAME_STATS
+			g->collision_tests += __builtin_popcount(boxes.live
+				& (hits ? (2u << j) - 1 : ~0u));
+#endif
+			if (hits) {
+				hit_asteroid(g, &g->asteroids[j]);
+				collide_load(&boxes, g->asteroids, NO_ASTEROIDS);
+			}
+#else
+			for (j = 0; j < NO_ASTEROIDS; j++) {
+				Asteroid *a = &g->asteroids[j];
+#ifdef GAME_STATS
+				g->collision_tests += a->size > 0;
+#endif
+				// Checks if the bullets are in collision with asteroids by
+				// checking the current position of the bullet and the
+				// half-way point between there and its last position (for
+				// collision accuracy)
+				if (a->size > 0 &&
+						((b->x > a->origin.x &&
+						b->x < a->origin.x + a->size &&
+						b->y > a->origin.y &&
+						b->y < a->origin.y + a->size)
+						|| (b->x-b->x_inc/2 > a->origin.x &&
+						b->x-b->x_inc/2 < a->origin.x + a->size &&
+						b->y-b->y_inc/2 > a->origin.y &&
+						b->y-b->y_inc/2 < a->origin.y + a->size))) {
+					hit_asteroid(g, a);
+					break;
+				}
+			}
+#endif
+
+			if (b->x > 320 || b->y > 240)
+				g->bullet_l = (g->bullet_l+1)%NO_BULLETS;
+		}
+	}
+
+	for (i = g->debris_l; i != g->debris_h; i=(i+1)%NO_DEBRIS) {
+			Shrapnel *d = &g->debris[i];
+			d->x+=d->x_inc;
+			d->y+=d->y_inc;
+
+			if (d->x > 320 || d->y > 240)
+				g->debris_l = (g->debris_l+1)%NO_DEBRIS;
+	}
+
+	if (g->wreckage_life > 0) {
+		for (i = 0; i < NO_WRECKAGE; i++) {
+				Wreckage *w = &g->wreckages[i];
+				w->points[0].x+=w->x_inc;
+				w->points[0].y+=w->y_inc;
+				w->points[1].x+=w->x_inc;
+				w->points[1].y+=w->y_inc;
+		}
+		g->wreckage_life--;
+	}
+
+	for (i = 0; i < NO_ASTEROIDS; i++) {
+		Asteroid *a = &g->asteroids[i];
+		if (a->size > 0) {
+			a->origin.x+=a->x_inc;
+			a->origin.y+=a->y_inc;
+
+			if (a->origin.x > 320)
+				a->origin.x = -50;
+			if (a->origin.x < -50)
+				a->origin.x = 320;
+			if (a->origin.y > 240)
+				a->origin.y = -50;
+			if (a->origin.y < -50)
+				a->origin.y = 240;
+		}
+	}
+
+	check_collision(g);
+}
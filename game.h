@@ -0,0 +1,148 @@
+/*
+ * Game core: state, physics, collision and spawning, with no hardware
+ * behind it. The platform feeds one GameInput per tick into game_step();
+ * drawing lives in render.c. Builds unchanged on the host (see tools/).
+ */
+
+#ifndef GAME_H
+#define GAME_H
+
+#include <stdint.h>
+
+#define PI 3.14159265
+
+#define START_STATE 0
+#define PLAY_STATE 1
+#define END_STATE 2
+
+#define DEAD 0
+#define INVINCIBLE 1
+#define VINCIBLE 2
+
+#define NO_ASTEROIDS 12
+#define NO_DEBRIS 10
+#define NO_BULLETS 10
+#define NO_WRECKAGE 4
+#define ASTEROID_PERIOD 64
+#define TURN_ANGLE 0.23
+#define ROTARY_ANGLE 0.2618 // One turn of a 24 detent knob spins the ship once.
+#define ASTEROID_POINTS 4
+#define SHIP_POINTS 8
+#define SHIP_ACCELERATION 0.9
+#define SHIP_DECELERATION 0.2
+#define BIG_SIZE 40
+#define MID_SIZE 30
+#define SMALL_SIZE 15
+#define PENALTY 5
+
+#define GAME_RAND_MAX 0x7FFF
+
+// Bits of GameInput.held and .pressed, at the BTN_* positions of switches.h.
+#define INPUT_THRUST (1 << 0)
+#define INPUT_RIGHT  (1 << 1)
+#define INPUT_LEFT   (1 << 3)
+#define INPUT_FIRE   (1 << 4)
+
+typedef struct {
+	float x;
+	float y;
+} Point;
+
+typedef struct {
+	Point origin;
+	Point points[SHIP_POINTS];
+
+	uint8_t state;
+	uint8_t thrusting;
+
+	float x_inc;
+	float y_inc;
+	float x_dec;
+	float y_dec;
+	float angle;
+
+	float horz_v;
+	float vert_v;
+} Ship;
+
+typedef struct {
+	uint16_t x;
+	uint16_t y;
+	int16_t x_inc;
+	int16_t y_inc;
+} Bullet;
+
+typedef struct {
+	uint16_t x;
+	uint16_t y;
+	int16_t x_inc;
+	int16_t y_inc;
+} Shrapnel;
+
+typedef struct {
+	Point origin;
+	Point points[ASTEROID_POINTS];
+	float x_inc;
+	float y_inc;
+	uint8_t size;
+} Asteroid;
+
+typedef struct {
+	Point points[2];
+	float x_inc;
+	float y_inc;
+} Wreckage;
+
+/* One tick of player input. */
+typedef struct {
+	uint8_t held;    // INPUT_* buttons down this tick.
+	uint8_t pressed; // INPUT_* buttons that went down since the last tick.
+	int8_t turn;     // Rotary detents, +ve clockwise.
+} GameInput;
+
+typedef struct {
+	uint8_t state;
+	uint8_t stress; // Spawn asteroids as fast as there is room for them.
+	uint16_t score;
+	uint16_t tick;
+	uint32_t rng;
+
+	Ship ship;
+	uint16_t inv_timer;
+	uint16_t respawn_timer;
+
+	// "Stack" for the debris.
+	Shrapnel debris[NO_DEBRIS];
+	uint8_t debris_l;
+	uint8_t debris_h;
+
+	// "Stack" for the bullets.
+	Bullet bullets[NO_BULLETS];
+	uint8_t bullet_l;
+	uint8_t bullet_h;
+
+	// "Stack" for the asteroids.
+	Asteroid asteroids[NO_ASTEROIDS+1];
+	uint8_t asteroid_i;
+	uint16_t pot_asteroids; // Potential asteroids, counting future splits.
+	uint8_t a_timer;
+
+	Wreckage wreckages[NO_WRECKAGE];
+	uint8_t wreckage_life;
+
+#ifdef GAME_STATS
+	uint32_t collision_tests; // Box tests done by update(), ever.
+#endif
+} Game;
+
+void game_init(Game *g, uint16_t seed);
+void game_step(Game *g, const GameInput *in);
+uint16_t game_rand(Game *g);
+uint8_t game_asteroids(const Game *g);
+uint8_t game_bullets(const Game *g);
+uint8_t game_debris(const Game *g);
+#ifdef GAME_STATS
+uint32_t game_hash(const Game *g);
+#endif
+
+#endif
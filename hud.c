@@ -0,0 +1,88 @@
+#include "hud.h"
+#include "lcd.h"
+
+/*
+ * Notes that the screen under the widget has been cleared, so blank cells
+ * need no drawing.
+ */
+void hud_clear(HudNumber *h) {
+	uint8_t i;
+	for (i = 0; i < HUD_CELLS; i++)
+		h->shown[i] = ' ';
+}
+
+/*
+ * Forgets the cells a box at x, y of w by ht pixels touches, edges
+ * included as draw_outline_rectangle() draws them, so the next
+ * hud_number() redraws them.
+ */
+void hud_damage(HudNumber *h, int16_t x, int16_t y, int16_t w, int16_t ht) {
+	int16_t first, last;
+	if (y > (int16_t) h->y + GLYPH_H - 1 || y + ht < (int16_t) h->y)
+		return;
+	first = x - (int16_t) h->x;
+	last = first + w;
+	if (last < 0 || first >= HUD_CELLS * GLYPH_W)
+		return;
+	first = first < 0 ? 0 : first / GLYPH_W;
+	last = last >= HUD_CELLS * GLYPH_W ? HUD_CELLS - 1 : last / GLYPH_W;
+	while (first <= last)
+		h->shown[first++] = 0;
+}
+
+/*
+ * Lays out the label and value, formatted as "%d" does, with the cells
+ * after it blank so a shorter number wipes out a longer one.
+ */
+static void format(const HudNumber *h, uint16_t value, char *cells) {
+	char digits[HUD_DIGITS];
+	uint8_t n = 0, i;
+	do {
+		digits[n++] = '0' + value % 10;
+		value /= 10;
+	} while (value);
+	for (i = 0; h->label[i]; i++)
+		cells[i] = h->label[i];
+	while (n)
+		cells[i++] = digits[--n];
+	while (i < HUD_CELLS)
+		cells[i++] = ' ';
+}
+
+/*
+ * Glyphs hud_number() would draw for value, for budgeting ahead of it.
+ */
+uint8_t hud_changes(const HudNumber *h, uint16_t value) {
+	char cells[HUD_CELLS];
+	uint8_t i, n = 0;
+	format(h, value, cells);
+	for (i = 0; i < HUD_CELLS; i++)
+		if (cells[i] != h->shown[i])
+			n++;
+	return n;
+}
+
+/*
+ * Brings the widget up to date with value, drawing each run of cells that
+ * differ from what is on screen in one go. Returns the glyphs drawn.
+ */
+uint8_t hud_number(HudNumber *h, uint16_t value) {
+	char cells[HUD_CELLS], run[HUD_CELLS + 1];
+	uint8_t i = 0, j, n = 0;
+	format(h, value, cells);
+	while (i < HUD_CELLS) {
+		if (cells[i] == h->shown[i]) {
+			i++;
+			continue;
+		}
+		for (j = i; j < HUD_CELLS && cells[j] != h->shown[j]; j++) {
+			run[j - i] = cells[j];
+			h->shown[j] = cells[j];
+		}
+		run[j - i] = 0;
+		display_string_xy(run, h->x + i * GLYPH_W, h->y);
+		n += j - i;
+		i = j;
+	}
+	return n;
+}
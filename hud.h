@@ -0,0 +1,23 @@
+/*
+ * HUD widgets: a label and a number after it, kept as a row of glyph
+ * cells that are only redrawn when what they should show changes or
+ * something has been drawn over them, in place of a display_thing_xy() of
+ * the whole line every frame.
+ */
+
+#include <stdint.h>
+
+#define HUD_DIGITS 5 // Enough for any uint16_t.
+#define HUD_CELLS 16 // Label and digits.
+
+/* Set up with an initialiser: { x, y, "Label: " }. */
+typedef struct {
+	uint16_t x, y;
+	char *label; // At most HUD_CELLS - HUD_DIGITS characters.
+	char shown[HUD_CELLS]; // What each cell shows, 0 if not known.
+} HudNumber;
+
+void hud_clear(HudNumber *h);
+void hud_damage(HudNumber *h, int16_t x, int16_t y, int16_t w, int16_t ht);
+uint8_t hud_changes(const HudNumber *h, uint16_t value);
+uint8_t hud_number(HudNumber *h, uint16_t value);
@@ -0,0 +1,68 @@
+#include "latency.h"
+#include "clock.h"
+
+uint16_t latency_hist[LAT_BUCKETS];
+uint16_t latency_count = 0;
+uint32_t latency_max_us = 0;
+
+uint32_t pending[LAT_KINDS];
+uint8_t is_pending = 0;
+
+/*
+ * Notes that an input edge at edge_us has changed the game in a way the next
+ * draw of kind will show. The oldest unshown edge is the one measured.
+ */
+void latency_stamp(uint8_t kind, uint32_t edge_us) {
+	if ((is_pending & (1 << kind)) && (int32_t) (edge_us - pending[kind]) >= 0)
+		return;
+	pending[kind] = edge_us;
+	is_pending |= 1 << kind;
+}
+
+/*
+ * Called right after the LCD write that shows kind; records the latency of
+ * the pending edge, if any.
+ */
+void latency_photon(uint8_t kind) {
+	if (!(is_pending & (1 << kind)))
+		return;
+	is_pending &= ~(1 << kind);
+	
+	uint32_t us = clock_us() - pending[kind];
+	uint32_t bucket = us / LAT_BUCKET_US;
+	if (bucket >= LAT_BUCKETS)
+		bucket = LAT_BUCKETS - 1;
+	if (latency_hist[bucket] < UINT16_MAX && latency_count < UINT16_MAX) {
+		latency_hist[bucket]++;
+		latency_count++;
+	}
+	if (us > latency_max_us)
+		latency_max_us = us;
+}
+
+/*
+ * Upper edge, in ms, of the bucket holding the given percentile.
+ */
+uint16_t latency_percentile_ms(uint8_t percent) {
+	uint32_t target = ((uint32_t) latency_count * percent + 99) / 100;
+	uint32_t seen = 0;
+	uint8_t i;
+	
+	if (latency_count == 0)
+		return 0;
+	for (i = 0; i < LAT_BUCKETS - 1; i++) {
+		seen += latency_hist[i];
+		if (seen >= target)
+			break;
+	}
+	return (uint32_t) (i + 1) * LAT_BUCKET_US / 1000;
+}
+
+void latency_reset() {
+	uint8_t i;
+	for (i = 0; i < LAT_BUCKETS; i++)
+		latency_hist[i] = 0;
+	latency_count = 0;
+	latency_max_us = 0;
+	is_pending = 0;
+}
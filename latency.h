@@ -0,0 +1,22 @@
+/*
+ * Input-to-photon latency: time from a button edge to the first LCD write
+ * that shows its effect, kept as a histogram in SRAM.
+ */
+
+#include <stdint.h>
+
+#define LAT_FIRE 0 // Fire press -> new bullet pixel.
+#define LAT_SHIP 1 // Steer/thrust press -> redrawn ship.
+#define LAT_KINDS 2
+
+#define LAT_BUCKET_US 2000
+#define LAT_BUCKETS 64 // Last bucket collects everything slower.
+
+extern uint16_t latency_hist[LAT_BUCKETS];
+extern uint16_t latency_count;
+extern uint32_t latency_max_us;
+
+void latency_stamp(uint8_t kind, uint32_t edge_us);
+void latency_photon(uint8_t kind);
+uint16_t latency_percentile_ms(uint8_t percent);
+void latency_reset();
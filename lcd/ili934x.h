@@ -9,10 +9,21 @@
 #define CMD_ADDR  0x4000
 #define DATA_ADDR 0x4100
 
+#ifdef HOST
+/* Host builds drive the software model in tools/ili9341.c. */
+void ili9341_cmd(unsigned char cmd);
+void ili9341_data(unsigned char data);
+void ili9341_data16(unsigned short data);
+#define write_cmd(cmd)				ili9341_cmd(cmd);
+#define write_data(data)			ili9341_data(data);
+#define write_data16(data)			ili9341_data16(data);
+#define write_cmd_data(cmd, data)	{ ili9341_cmd(cmd); ili9341_data(data); }
+#else
 #define write_cmd(cmd)				asm volatile("sts %0,%1" :: "i" (CMD_ADDR), "r" (cmd) : "memory");
 #define write_data(data)			asm volatile("sts %0,%1" :: "i" (DATA_ADDR), "r" (data) : "memory");
 #define write_data16(data)			asm volatile("sts %0,%B1 \n\t sts %0,%A1" :: "i" (DATA_ADDR), "r" (data)  : "memory");
 #define write_cmd_data(cmd, data)	asm volatile("sts %0,%1 \n\t sts %2,%3" :: "i" (CMD_ADDR), "r" (cmd), "i" (DATA_ADDR), "r" (data)  : "memory");
+#endif
   
 /* Basic Commands */
 #define NO_OPERATION								0x00
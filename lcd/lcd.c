@@ -9,50 +9,72 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
+#include <math.h>
 #include "font.h"
 #include "ili934x.h"
 #include "lcd.h"
 #include "stdarg.h"
+#include "trace.h"
 
 lcd display;
 
 int power(int n, int e);
 
 void init_lcd() {
-    /* Enable extended memory interface with 10 bit addressing */
-    XMCRB = _BV(XMM2) | _BV(XMM1);
-    XMCRA = _BV(SRE);
-    DDRC |= _BV(RESET);
-    DDRB |= _BV(BLC);
-    _delay_ms(1);
-    PORTC &= ~_BV(RESET);
-    _delay_ms(20);
-    PORTC |= _BV(RESET);
-    _delay_ms(120);
-    write_cmd(DISPLAY_OFF);
-    write_cmd(SLEEP_OUT);
-    _delay_ms(60);
-    write_cmd_data(INTERNAL_IC_SETTING,          0x01);
-    write_cmd(POWER_CONTROL_1);
-        write_data16(0x2608);
-    write_cmd_data(POWER_CONTROL_2,              0x10);
-    write_cmd(VCOM_CONTROL_1);
-        write_data16(0x353E);
-    write_cmd_data(VCOM_CONTROL_2, 0xB5);
-    write_cmd_data(INTERFACE_CONTROL, 0x01);
-        write_data16(0x0000);
-    write_cmd_data(PIXEL_FORMAT_SET, 0x55);     /* 16bit/pixel */
-    set_orientation(West);
-    clear_screen();
-    display.x = 0;
-    display.y = 0;
-    display.background = BLACK;
-    display.foreground = WHITE;
-    write_cmd(DISPLAY_ON);
-    _delay_ms(50);
-    write_cmd_data(TEARING_EFFECT_LINE_ON, 0x00);
-    EICRB |= _BV(ISC61);
-    PORTB |= _BV(BLC);
+    uint8_t ms;
+    while ((ms = init_lcd_step()))
+        while (ms--)
+            _delay_ms(1);
+}
+
+/* Runs the next stage of the panel power-up sequence and returns how
+   many milliseconds to wait before calling it again, or 0 once the
+   display is on. Lets the caller do other work during the delays.
+*/
+uint8_t init_lcd_step() {
+    static uint8_t stage = 0;
+    switch (stage++) {
+    case 0:
+        /* Enable extended memory interface with 10 bit addressing */
+        XMCRB = _BV(XMM2) | _BV(XMM1);
+        XMCRA = _BV(SRE);
+        DDRC |= _BV(RESET);
+        DDRB |= _BV(BLC);
+        return 1;
+    case 1:
+        PORTC &= ~_BV(RESET);
+        return 20;
+    case 2:
+        PORTC |= _BV(RESET);
+        return 120;
+    case 3:
+        write_cmd(DISPLAY_OFF);
+        write_cmd(SLEEP_OUT);
+        return 60;
+    case 4:
+        write_cmd_data(INTERNAL_IC_SETTING,          0x01);
+        write_cmd(POWER_CONTROL_1);
+            write_data16(0x2608);
+        write_cmd_data(POWER_CONTROL_2,              0x10);
+        write_cmd(VCOM_CONTROL_1);
+            write_data16(0x353E);
+        write_cmd_data(VCOM_CONTROL_2, 0xB5);
+        write_cmd_data(INTERFACE_CONTROL, 0x01);
+            write_data16(0x0000);
+        write_cmd_data(PIXEL_FORMAT_SET, 0x55);     /* 16bit/pixel */
+        set_orientation(West);
+        display.background = BLACK;
+        display.foreground = WHITE;
+        clear_screen();
+        write_cmd(DISPLAY_ON);
+        return 50;
+    default:
+        write_cmd_data(TEARING_EFFECT_LINE_ON, 0x00);
+        EICRB |= _BV(ISC61);
+        PORTB |= _BV(BLC);
+        stage = 0;
+        return 0;
+    }
 }
 
 void lcd_brightness(uint8_t i) {
@@ -95,7 +117,7 @@ void set_orientation(orientation o) {
 
 
 
-void set_frame_rate_hz(uint8_t f) {
+static void frame_rate(uint8_t cmd, uint8_t f) {
     uint8_t diva, rtna, period;
     if (f>118)
         f = 118;
@@ -115,12 +137,31 @@ void set_frame_rate_hz(uint8_t f) {
     /*   See ILI9341 datasheet, page 155  */
     period = 1920.0/f;
     rtna = period >> diva;
-    write_cmd(FRAME_CONTROL_IN_NORMAL_MODE);
+    write_cmd(cmd);
     write_data(diva);
     write_data(rtna);
 }
 
+void set_frame_rate_hz(uint8_t f) {
+    frame_rate(FRAME_CONTROL_IN_NORMAL_MODE, f);
+}
+
+void set_idle_frame_rate_hz(uint8_t f) {
+    frame_rate(FRAME_CONTROL_IN_IDLE_MODE, f);
+}
+
+/* Idle mode drops the panel to 8 colours, which costs less power
+   while the picture is static. */
+void lcd_idle_mode(uint8_t on) {
+    if (on) {
+        write_cmd(IDLE_MODE_ON);
+    } else {
+        write_cmd(IDLE_MODE_OFF);
+    }
+}
+
 void fill_rectangle(rectangle r, uint16_t col) {
+    TRACE_LCD_BEGIN(TR_LCD_FILL);
     write_cmd(COLUMN_ADDRESS_SET);
     write_data16(r.left);
     write_data16(r.right);
@@ -163,6 +204,158 @@ void fill_rectangle(rectangle r, uint16_t col) {
         write_data16(col);
         write_data16(col);
     }
+    TRACE_LCD_END(TR_LCD_FILL);
+}
+
+/*  Writes n pixels of one colour, eight at a time where it can. */
+static void write_run(uint16_t col, uint16_t n) {
+    uint8_t pix1 = n & 0x07;
+    uint16_t pix8 = n >> 3;
+    while(pix1--)
+        write_data16(col);
+    while(pix8--) {
+        write_data16(col);
+        write_data16(col);
+        write_data16(col);
+        write_data16(col);
+        write_data16(col);
+        write_data16(col);
+        write_data16(col);
+        write_data16(col);
+    }
+}
+
+/*  Draws an RLE image from flash (see lcd.h) with its top left corner at
+    x, y: one window and one MEMORY_WRITE for the lot, each run a burst of
+    the same colour.
+*/
+void display_image(const uint8_t *img, uint16_t x, uint16_t y) {
+    uint16_t palette[IMAGE_COLOURS];
+    uint16_t w = pgm_read_word(img), h = pgm_read_word(img + 2), n;
+    uint32_t left = (uint32_t) w * h;
+    uint8_t colours = pgm_read_byte(img + 4), i, code;
+
+    img += 5;
+    for (i = 0; i < IMAGE_COLOURS; i++)
+        palette[i] = i < colours ? pgm_read_word(img + 2 * i) : BLACK;
+    img += 2 * colours;
+
+    TRACE_LCD_BEGIN(TR_LCD_IMAGE);
+    write_cmd(COLUMN_ADDRESS_SET);
+    write_data16(x);
+    write_data16(x + w - 1);
+    write_cmd(PAGE_ADDRESS_SET);
+    write_data16(y);
+    write_data16(y + h - 1);
+    write_cmd(MEMORY_WRITE);
+    while (left) {
+        code = pgm_read_byte(img++);
+        n = (code >> 4) + 1;
+        if (code >> 4 == IMAGE_LONG_RUN) {
+            n = pgm_read_word(img);
+            img += 2;
+        }
+        if (n == 0 || n > left)
+            n = left;
+        write_run(palette[code & 0x0F], n);
+        left -= n;
+    }
+    TRACE_LCD_END(TR_LCD_IMAGE);
+}
+
+/*  Draws a sprite with its origin at x, y, clipped to the screen, in the
+    given colours, or its own if NULL. Only the opaque spans are written,
+    each through a window of its own one row high, with the page set once
+    for each row that has any.
+*/
+static void blit_sprite(const uint8_t *spr, int16_t x, int16_t y,
+        const uint16_t *colours) {
+    uint16_t palette[IMAGE_COLOURS];
+    uint8_t h = pgm_read_byte(spr + 1), n = pgm_read_byte(spr + 4), i;
+    uint8_t spans, len, code, run;
+    int16_t sx, skip, take;
+
+    x -= pgm_read_byte(spr + 2);
+    y -= pgm_read_byte(spr + 3);
+    spr += 5;
+    for (i = 0; i < IMAGE_COLOURS; i++)
+        palette[i] = colours ? colours[i < n ? i : 0]
+            : i < n ? pgm_read_word(spr + 2 * i) : BLACK;
+    spr += 2 * n;
+
+    TRACE_LCD_BEGIN(TR_LCD_SPRITE);
+    for (; h; h--, y++) {
+        uint8_t page = 0;
+        for (spans = pgm_read_byte(spr++); spans; spans--) {
+            sx = x + pgm_read_byte(spr++);
+            len = pgm_read_byte(spr++);
+            skip = sx < 0 ? -sx : 0;
+            take = len - skip;
+            if (sx + len > (int16_t) display.width)
+                take -= sx + len - display.width;
+            if (y < 0 || y >= (int16_t) display.height || take <= 0) {
+                for (; len; len -= (code >> 4) + 1)
+                    code = pgm_read_byte(spr++);
+                continue;
+            }
+            if (!page) {
+                write_cmd(PAGE_ADDRESS_SET);
+                write_data16(y);
+                write_data16(y);
+                page = 1;
+            }
+            write_cmd(COLUMN_ADDRESS_SET);
+            write_data16(sx + skip);
+            write_data16(sx + skip + take - 1);
+            write_cmd(MEMORY_WRITE);
+            for (; len; len -= (code >> 4) + 1) {
+                code = pgm_read_byte(spr++);
+                run = (code >> 4) + 1;
+                if (skip >= run) {
+                    skip -= run;
+                    continue;
+                }
+                run -= skip;
+                skip = 0;
+                if (run > take)
+                    run = take;
+                write_run(palette[code & 0x0F], run);
+                take -= run;
+            }
+        }
+    }
+    TRACE_LCD_END(TR_LCD_SPRITE);
+}
+
+/*  Draws a sprite (see lcd.h) with its origin at x, y. A palette, if
+    given, recolours it: entry i stands in for the sprite's colour i, and
+    there must be one for each of its colours.
+*/
+void display_sprite(const uint8_t *spr, int16_t x, int16_t y,
+        const uint16_t *palette) {
+    blit_sprite(spr, x, y, palette);
+}
+
+/*  Paints over a sprite drawn at x, y in one colour, through the same
+    spans, so only its own pixels are touched.
+*/
+void erase_sprite(const uint8_t *spr, int16_t x, int16_t y, uint16_t col) {
+    uint16_t palette[IMAGE_COLOURS];
+    uint8_t i;
+    for (i = 0; i < IMAGE_COLOURS; i++)
+        palette[i] = col;
+    blit_sprite(spr, x, y, palette);
+}
+
+/*  The screen box a sprite drawn at x, y covers: its top left corner and
+    size.
+*/
+void sprite_box(const uint8_t *spr, int16_t *x, int16_t *y, uint8_t *w,
+        uint8_t *h) {
+    *x -= pgm_read_byte(spr + 2);
+    *y -= pgm_read_byte(spr + 3);
+    *w = pgm_read_byte(spr);
+    *h = pgm_read_byte(spr + 1);
 }
 
 void fill_rectangle_indexed(rectangle r, uint16_t *col) {
@@ -193,11 +386,13 @@ void draw_line(int x0, int y0, int x1, int y1, int col) {
 	float x = x0;
 	float y = y0;
 	int i; 
+	TRACE_LCD_BEGIN(TR_LCD_LINE);
 	for (i = 0; i < steps; i++) {
 		x += x_inc;
 		y += y_inc;
 		draw_pixel((uint16_t) x, (uint16_t) y, col);
 	}
+	TRACE_LCD_END(TR_LCD_LINE);
 }
 
 void draw_polygon(int16_t x, int16_t y, int16_t xs[], int16_t ys[], uint16_t num_points,uint16_t col) {
@@ -219,6 +414,7 @@ void draw_outline_rectangle(int16_t x, int16_t y, int16_t width, int16_t height,
 	uint8_t draw_top = (y<0)?0:1;
 	
 	int16_t i;
+	TRACE_LCD_BEGIN(TR_LCD_RECT);
 	// Draw top horizontal.
 	if (draw_top) {
 		write_cmd(COLUMN_ADDRESS_SET);
@@ -252,12 +448,14 @@ void draw_outline_rectangle(int16_t x, int16_t y, int16_t width, int16_t height,
 			draw_pixel(x, y+i, col);
 		draw_pixel(x+width, y+i, col);
 	}
+	TRACE_LCD_END(TR_LCD_RECT);
 }
 
 void draw_pixel(uint16_t x, uint16_t y, uint16_t col) {
 	if (x > 320 || y > 240)
 		return;
 
+	TRACE_LCD_BEGIN(TR_LCD_PIXEL);
 	write_cmd(COLUMN_ADDRESS_SET);
 	write_data16(x);
 	write_data16(x+1);
@@ -266,6 +464,7 @@ void draw_pixel(uint16_t x, uint16_t y, uint16_t col) {
 	write_data16(y+1);
 	write_cmd(MEMORY_WRITE);
 	write_data16(col);
+	TRACE_LCD_END(TR_LCD_PIXEL);
 }
 
 void clear_screen() {
@@ -275,50 +474,110 @@ void clear_screen() {
     fill_rectangle(r, display.background);
 }
 
-void display_char(char c) {
-    uint16_t x, y;
-    PGM_P fdata; 
-    uint8_t bits, mask;
-    uint16_t sc=display.x, ec=display.x + 4, sp=display.y, ep=display.y + 7;
-
-    /*   New line starts a new line, or if the end of the
-         display has been reached, clears the display.
-    */
-    if (c == '\n') { 
-        display.x=0; display.y+=8;
-        if (display.y >= display.height) { clear_screen(); }
-        return;
-    }
+#define GLYPH_RUN 8 /* Glyphs blitted through one window. */
 
-    if (c < 32 || c > 126) return;
-    fdata = (c - ' ')*5 + font5x7;
-    write_cmd(PAGE_ADDRESS_SET);
-    write_data16(sp);
-    write_data16(ep);
-    for(x=sc; x<=ec; x++) {
-        write_cmd(COLUMN_ADDRESS_SET);
-        write_data16(x);
-        write_data16(x);
-        write_cmd(MEMORY_WRITE);
+#if GLYPH_CACHE
+static uint8_t glyph_cache[GLYPH_CACHE][GLYPH_H];
+static uint16_t glyph_cached; /* Bit i set once glyph_cache[i] is filled. */
+#endif
+
+/*  Returns glyph c as GLYPH_H rows, bit i of each the pixel i columns in.
+    The font stores columns, so this turns it round, into buf unless the
+    glyph is in the cache.
+*/
+static const uint8_t *glyph_rows(char c, uint8_t *buf) {
+    PGM_P fdata = (c - ' ')*5 + font5x7;
+    uint8_t col, row, bits;
+#if GLYPH_CACHE
+    uint8_t i = c - GLYPH_CACHE_FIRST;
+    if (i < GLYPH_CACHE) {
+        if (glyph_cached & _BV(i))
+            return glyph_cache[i];
+        buf = glyph_cache[i];
+        glyph_cached |= _BV(i);
+    }
+#endif
+    for (row = 0; row < GLYPH_H; row++)
+        buf[row] = 0;
+    for (col = 0; col < 5; col++) {
         bits = pgm_read_byte(fdata++);
-        for(y=sp, mask=0x01; y<=ep; y++, mask<<=1)
-            write_data16((bits & mask) ? display.foreground : display.background);
+        for (row = 0; row < GLYPH_H; row++, bits >>= 1)
+            if (bits & 1)
+                buf[row] |= _BV(col);
     }
+    return buf;
+}
+
+/*  Draws n printable glyphs side by side at the cursor, each pixel scale
+    by scale, through one window filled in the panel's scan order: across
+    the whole run, then down.
+*/
+static void blit_glyphs(const char *str, uint8_t n, uint8_t scale) {
+    uint8_t buf[GLYPH_RUN][GLYPH_H];
+    const uint8_t *rows[GLYPH_RUN];
+    uint16_t fg = display.foreground, bg = display.background;
+    uint16_t w = (uint16_t) n * GLYPH_W * scale;
+    uint8_t g, row, ry, col, rx, bits;
+
+    TRACE_LCD_BEGIN(TR_LCD_CHAR);
+    for (g = 0; g < n; g++)
+        rows[g] = glyph_rows(str[g], buf[g]);
     write_cmd(COLUMN_ADDRESS_SET);
-    write_data16(x);
-    write_data16(x);
+    write_data16(display.x);
+    write_data16(display.x + w - 1);
+    write_cmd(PAGE_ADDRESS_SET);
+    write_data16(display.y);
+    write_data16(display.y + GLYPH_H * scale - 1);
     write_cmd(MEMORY_WRITE);
-    for(y=sp; y<=ep; y++)
-        write_data16(display.background);
+    for (row = 0; row < GLYPH_H; row++)
+        for (ry = 0; ry < scale; ry++)
+            for (g = 0; g < n; g++)
+                for (col = 0, bits = rows[g][row]; col < GLYPH_W; col++, bits >>= 1)
+                    for (rx = 0; rx < scale; rx++)
+                        write_data16((bits & 1) ? fg : bg);
+    display.x += w;
+    TRACE_LCD_END(TR_LCD_CHAR);
+}
+
+/*  Draws a string at the cursor, a run of glyphs at a time. A newline
+    starts a new line, or if the end of the display has been reached,
+    clears the display; text that reaches the right edge wraps.
+*/
+static void draw_string(const char *str, uint8_t scale) {
+    uint16_t cell = GLYPH_W * scale;
+    uint8_t n;
 
-    display.x += 6;
-    if (display.x >= display.width) { display.x=0; display.y+=8; }
+    while (*str) {
+        if (*str == '\n') {
+            display.x = 0;
+            display.y += GLYPH_H * scale;
+            if (display.y >= display.height) { clear_screen(); }
+            str++;
+            continue;
+        }
+        for (n = 0; n < GLYPH_RUN && str[n] >= 32 && str[n] <= 126
+                && (n == 0 || display.x + (n + 1) * cell <= display.width); n++)
+            ;
+        if (n == 0) {
+            str++;
+            continue;
+        }
+        blit_glyphs(str, n, scale);
+        str += n;
+        if (display.x >= display.width) {
+            display.x = 0;
+            display.y += GLYPH_H * scale;
+        }
+    }
+}
+
+void display_char(char c) {
+    char str[2] = { c, 0 };
+    draw_string(str, 1);
 }
 
 void display_string(char *str) {
-    uint8_t i;
-    for(i=0; str[i]; i++) 
-        display_char(str[i]);
+    draw_string(str, 1);
 }
 
 void display_f(char *str, ...) {
@@ -370,11 +629,17 @@ void display_color(uint16_t fg, uint16_t bg) {
 }
 
 void display_string_xy(char *str, uint16_t x, uint16_t y) {
-    uint8_t i;
     display.x = x;
     display.y = y;
-    for(i=0; str[i]; i++)
-        display_char(str[i]);
+    draw_string(str, 1);
+}
+
+/* Large text, for titles: each pixel of the font drawn scale by scale. */
+void display_string_scaled_xy(char *str, uint16_t x, uint16_t y,
+        uint8_t scale) {
+    display.x = x;
+    display.y = y;
+    draw_string(str, scale);
 }
 
 void display_thing_xy(uint16_t x, uint16_t y, char *str, uint16_t thing) {
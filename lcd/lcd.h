@@ -11,6 +11,30 @@
 #define LCDWIDTH	240
 #define LCDHEIGHT	320
 
+#define GLYPH_W 6 // A 5x7 font glyph and its spacing.
+#define GLYPH_H 8
+
+// Glyphs kept turned round in SRAM, GLYPH_H bytes each, from
+// GLYPH_CACHE_FIRST on; at most 16. -DGLYPH_CACHE=0 does without.
+#ifndef GLYPH_CACHE
+#define GLYPH_CACHE 10
+#endif
+#define GLYPH_CACHE_FIRST '0'
+
+// Run-length encoded images in flash, as tools/rle565 writes them: width
+// and height (16 bits each, little endian), a count of up to IMAGE_COLOURS
+// RGB565 palette entries and the entries, then runs of pixels in scan
+// order, each one byte, llll iiii: l+1 pixels of palette colour i; or if
+// l is 15, three, with the length in the next two bytes.
+#define IMAGE_COLOURS 16
+#define IMAGE_LONG_RUN 0x0F
+
+// Sprites in flash, as tools/sprite565 writes them from art on a key
+// colour: width, height and the origin's x and y within them, a byte each;
+// a palette as for images; then for each row a count of opaque spans, and
+// for each span its x and length, a byte each, and image runs (llll iiii,
+// l+1 pixels) that add up to the length.
+
 typedef enum {North, West, South, East} orientation;
 
 typedef struct {
@@ -28,17 +52,28 @@ typedef struct {
 } rectangle;		
 
 void init_lcd();
+uint8_t init_lcd_step();
 void lcd_brightness(uint8_t i);
 void set_orientation(orientation o);
 void set_frame_rate_hz(uint8_t f);
+void set_idle_frame_rate_hz(uint8_t f);
+void lcd_idle_mode(uint8_t on);
 void clear_screen();
 void fill_rectangle(rectangle r, uint16_t col);
 void fill_rectangle_indexed(rectangle r, uint16_t* col);
+void display_image(const uint8_t *img, uint16_t x, uint16_t y);
+void display_sprite(const uint8_t *spr, int16_t x, int16_t y,
+	const uint16_t *palette);
+void erase_sprite(const uint8_t *spr, int16_t x, int16_t y, uint16_t col);
+void sprite_box(const uint8_t *spr, int16_t *x, int16_t *y, uint8_t *w,
+	uint8_t *h);
 void display_char(char c);
 void display_string(char *str);
 void display_int(uint16_t n);
 void display_f(char *str, ...);
 void display_string_xy(char *str, uint16_t x, uint16_t y);
+void display_string_scaled_xy(char *str, uint16_t x, uint16_t y,
+	uint8_t scale);
 void display_move(uint16_t x, uint16_t y);
 void display_color(uint16_t fg, uint16_t bg);
 void draw_pixel(uint16_t x, uint16_t y, uint16_t col);
@@ -45,6 +45,8 @@ File: printf.c
 
 void putchar_lcd(char c);
 
+static void flush_lcd();
+
 static char* bf;
 static char buf[12];
 static unsigned int num;
@@ -148,12 +150,26 @@ void tfp_printf(char *fmt, ...)
 			}
 		}
 	abort:;
+	flush_lcd();
 	va_end(va);
 	}
 
 /* Output to TFT display-
    - could later add option to write to serial port or log file
+   Characters are gathered into a line so that they go out as runs
+   through display_string(), not a glyph at a time.
 */
+static char line[17];
+static unsigned char line_len;
+
+static void flush_lcd() {
+	line[line_len] = 0;
+	display_string(line);
+	line_len = 0;
+	}
+
 void putchar_lcd(char c) {
-	display_char(c);
-}
+	line[line_len++] = c;
+	if (line_len == sizeof(line) - 1)
+		flush_lcd();
+	}
@@ -0,0 +1,82 @@
+#include "power.h"
+#include <avr/io.h>
+#include <avr/sleep.h>
+#include "lcd.h"
+
+volatile uint8_t idle_percent = 100;
+
+static uint8_t level = POWER_ACTIVE;
+uint8_t brightness = BRIGHTNESS_ACTIVE;
+uint8_t frame_rate = FRAME_RATE_ACTIVE;
+static uint32_t busy_sum = 0;
+static uint32_t period_sum = 0;
+static uint8_t window = 0;
+
+void init_power() {
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	lcd_brightness(brightness);
+	set_frame_rate_hz(frame_rate);
+	set_idle_frame_rate_hz(FRAME_RATE_STATIC);
+}
+
+/*
+ * Sleeps until the next interrupt. All the game's work is done in
+ * interrupts, so main() can call this in a loop.
+ */
+void power_idle() {
+	sleep_mode();
+}
+
+/*
+ * Puts the panel into the given POWER_* level. Attract mode left alone
+ * dims the backlight and slows the refresh; a pause, with nothing moving,
+ * dims it and switches the controller to idle mode, which refreshes at its
+ * own rate. POWER_ACTIVE restores the player's settings.
+ */
+void power_level(uint8_t l) {
+	if (l == level)
+		return;
+	if (level == POWER_STATIC)
+		lcd_idle_mode(0);
+	level = l;
+	
+	if (level == POWER_ACTIVE) {
+		set_frame_rate_hz(frame_rate);
+		lcd_brightness(brightness);
+		return;
+	}
+	lcd_brightness(BRIGHTNESS_STATIC);
+	if (level == POWER_DIM)
+		set_frame_rate_hz(FRAME_RATE_DIM);
+	else
+		lcd_idle_mode(1);
+}
+
+/*
+ * Sets the backlight and panel refresh used while the picture is moving,
+ * from the player's settings. Takes effect at once unless dimmed.
+ */
+void power_settings(uint8_t b, uint8_t f) {
+	brightness = b;
+	frame_rate = f;
+	if (level == POWER_ACTIVE) {
+		set_frame_rate_hz(frame_rate);
+		lcd_brightness(brightness);
+	}
+}
+
+/*
+ * Records that a tick of the given period was busy for busy timer counts,
+ * and refreshes idle_percent every IDLE_WINDOW ticks.
+ */
+void power_account(uint16_t busy, uint16_t period) {
+	busy_sum += (busy < period)?busy:period;
+	period_sum += period;
+	
+	if (++window == IDLE_WINDOW) {
+		idle_percent = 100 - (uint8_t) (busy_sum * 100 / period_sum);
+		busy_sum = 0;
+		period_sum = 0;
+		window = 0;
+	}
+}
@@ -0,0 +1,29 @@
+/*
+ * Idle manager: sleeps the CPU between ticks and turns the panel down
+ * in attract mode and while the picture is static.
+ */
+
+#include <stdint.h>
+
+#define POWER_ACTIVE 0 // Levels for power_level().
+#define POWER_DIM 1
+#define POWER_STATIC 2
+
+#define BRIGHTNESS_ACTIVE 255 // Defaults for power_settings().
+#define BRIGHTNESS_STATIC 40
+#define FRAME_RATE_ACTIVE 70
+#define FRAME_RATE_STATIC 15 // Idle mode's own refresh, while paused.
+#define FRAME_RATE_DIM 30 // Attract mode left alone, still moving.
+#define FRAME_RATE_MIN 30
+#define FRAME_RATE_MAX 118
+#define IDLE_WINDOW 16 // Ticks averaged into idle_percent.
+
+extern volatile uint8_t idle_percent;
+extern uint8_t brightness; // The player's settings, set with power_settings().
+extern uint8_t frame_rate;
+
+void init_power();
+void power_idle();
+void power_level(uint8_t l);
+void power_settings(uint8_t b, uint8_t f);
+void power_account(uint16_t busy, uint16_t period);
@@ -0,0 +1,131 @@
+#include "recorder.h"
+#include "replay.h"
+#include "eewrite.h"
+#include <stddef.h>
+#include <avr/eeprom.h>
+
+#define SYNC_BYTES 6 // A run, its end mark, and the header's ticks and score.
+
+uint8_t rec_on = 0;
+uint16_t rec_pos;   // Where the next stream byte goes.
+uint16_t rec_ticks;
+ReplayEnc rec_enc;
+
+uint8_t play_on = 0;
+ReplayDec play_dec;
+
+/*
+ * Marks the end of the stream after the bytes written so far, so a
+ * recording cut off by a power cycle still ends cleanly. The next tick's
+ * codes write over it.
+ */
+static void mark_end() {
+	ee_write(rec_pos, REPLAY_END_CODE);
+}
+
+/*
+ * Starts a new recording over the old one.
+ */
+void record_start(uint16_t seed, uint8_t flags) {
+	if (ee_room() < sizeof(replay_header) + 1)
+		return;
+	rec_on = 1;
+	rec_ticks = 0;
+	rec_pos = REPLAY_ADDR + sizeof(replay_header);
+	replay_enc_init(&rec_enc);
+	ee_write_word(REPLAY_ADDR + offsetof(replay_header, magic), REPLAY_MAGIC);
+	ee_write(REPLAY_ADDR + offsetof(replay_header, version), REPLAY_VERSION);
+	ee_write(REPLAY_ADDR + offsetof(replay_header, flags), flags);
+	ee_write_word(REPLAY_ADDR + offsetof(replay_header, seed), seed);
+	ee_write_word(REPLAY_ADDR + offsetof(replay_header, ticks),
+		REPLAY_UNKNOWN);
+	ee_write_word(REPLAY_ADDR + offsetof(replay_header, score),
+		REPLAY_UNKNOWN);
+	mark_end();
+}
+
+/*
+ * Records the input for g's next physics step. The recording stops when
+ * the area is full or the queue has fallen too far behind, with room left
+ * for the final sync.
+ */
+void record_tick(const Game *g, const GameInput *in) {
+	uint8_t out[3], n, i;
+	if (!rec_on)
+		return;
+	if (rec_pos + sizeof(out) + 1 >= REPLAY_END
+			|| ee_room() < sizeof(out) + 1 + SYNC_BYTES) {
+		record_stop(g);
+		return;
+	}
+	n = replay_encode(&rec_enc, in, out);
+	rec_ticks++;
+	for (i = 0; i < n; i++)
+		ee_write(rec_pos++, out[i]);
+	if (n)
+		mark_end();
+}
+
+/*
+ * Writes out the run in progress and the tick count and score so far, so
+ * a playback can be checked against them.
+ */
+void record_sync(const Game *g) {
+	uint8_t b;
+	if (!rec_on)
+		return;
+	if (replay_flush(&rec_enc, &b)) {
+		ee_write(rec_pos++, b);
+		mark_end();
+	}
+	ee_write_word(REPLAY_ADDR + offsetof(replay_header, ticks), rec_ticks);
+	ee_write_word(REPLAY_ADDR + offsetof(replay_header, score), g->score);
+}
+
+void record_stop(const Game *g) {
+	record_sync(g);
+	rec_on = 0;
+}
+
+uint8_t recording() {
+	return rec_on;
+}
+
+static uint8_t ee_read(uint16_t addr) {
+	return eeprom_read_byte((const uint8_t *) addr);
+}
+
+/*
+ * Opens the recording in EEPROM for playback. Returns 0 if there is none,
+ * or if writes are still going out: reads would wait for them.
+ */
+uint8_t playback_start(uint16_t *seed, uint8_t *flags) {
+	replay_header h;
+	if (!ee_idle())
+		return 0;
+	eeprom_read_block(&h, (const void *) REPLAY_ADDR, sizeof(h));
+	if (h.magic != REPLAY_MAGIC || h.version != REPLAY_VERSION)
+		return 0;
+	*seed = h.seed;
+	*flags = h.flags;
+	replay_dec_init(&play_dec, ee_read);
+	play_on = 1;
+	return 1;
+}
+
+/*
+ * The next step's recorded input. Returns 0 when the recording runs out.
+ */
+uint8_t playback_next(GameInput *in) {
+	if (play_on && !replay_next(&play_dec, in))
+		play_on = 0;
+	return play_on;
+}
+
+void playback_stop() {
+	play_on = 0;
+}
+
+uint8_t playing_back() {
+	return play_on;
+}
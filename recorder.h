@@ -0,0 +1,18 @@
+/*
+ * Records games into the EEPROM replay area (replay.h) as they are
+ * played, through the eewrite.c queue, and plays them back.
+ */
+
+#include <stdint.h>
+#include "game.h"
+
+void record_start(uint16_t seed, uint8_t flags);
+void record_tick(const Game *g, const GameInput *in);
+void record_sync(const Game *g);
+void record_stop(const Game *g);
+uint8_t recording();
+
+uint8_t playback_start(uint16_t *seed, uint8_t *flags);
+uint8_t playback_next(GameInput *in);
+void playback_stop();
+uint8_t playing_back();
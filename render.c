@@ -0,0 +1,341 @@
+#include <math.h>
+#include <string.h>
+#include "render.h"
+#include "hud.h"
+#include "lcd.h"
+#include "latency.h"
+#include "ship.h"
+#include "trace.h"
+
+#define DRAWN_NONE 0
+#define DRAWN_FULL 1
+#define DRAWN_CORNERS 2
+
+#define SHIP_ROTATIONS (SHIP_SPRITES_FRAMES / 2) // Then again with the flame.
+
+uint16_t render_budget = BUDGET_MAX;
+uint16_t budget_left;
+
+// What is on screen now, so it can be erased next frame.
+const uint8_t *last_ship; // Its sprite, or NULL if it is not on screen.
+int16_t last_ship_x, last_ship_y;
+Shrapnel last_debris[NO_DEBRIS];
+uint16_t debris_drawn; // Bit i set if last_debris[i] is on screen.
+Bullet last_bullets[NO_BULLETS];
+uint8_t bullet_last_l;
+uint8_t bullet_last_h;
+Asteroid last_asteroids[NO_ASTEROIDS];
+uint8_t asteroid_drawn[NO_ASTEROIDS]; // How last_asteroids[i] is on screen.
+uint8_t asteroid_rr; // First asteroid to get budget next frame.
+Wreckage last_wreckages[NO_WRECKAGE];
+
+HudNumber score_hud = { 10, 10, "Score: ", { 0 } };
+
+/*
+ * Forgets what is on screen. Call after clearing it.
+ */
+void render_reset() {
+	uint8_t i;
+	last_ship = NULL;
+	memset(last_wreckages, 0, sizeof(last_wreckages));
+	debris_drawn = 0;
+	bullet_last_l = 0;
+	bullet_last_h = 0;
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		asteroid_drawn[i] = DRAWN_NONE;
+	asteroid_rr = 0;
+	hud_clear(&score_hud);
+}
+
+/*
+ * Takes cost bytes out of this frame's budget, or returns 0 if it would not
+ * fit.
+ */
+uint8_t spend(uint16_t cost) {
+	if (cost > budget_left)
+		return 0;
+	budget_left -= cost;
+	return 1;
+}
+
+/*
+ *	Draws the space ship, as the frame of ship.h nearest its angle.
+ */
+void draw_ship(const Ship *ship) {
+	static uint8_t thrust_frame = 0;
+
+	// Clear last position of ship.
+	if (last_ship)
+		erase_sprite(last_ship, last_ship_x, last_ship_y, BLACK);
+	last_ship = NULL;
+
+	if (ship->state == DEAD)
+		return;
+
+	// The frames are recoloured whole, whatever colours the sheet has.
+	uint16_t palette[IMAGE_COLOURS];
+	uint8_t i;
+	for (i = 0; i < IMAGE_COLOURS; i++)
+		palette[i] = ship->state==INVINCIBLE?GREY:WHITE;
+	int16_t r = (int32_t) floor((ship->angle + PI/2) * SHIP_ROTATIONS / (2*PI)
+		+ 0.5) % SHIP_ROTATIONS;
+	if (r < 0)
+		r += SHIP_ROTATIONS;
+	if (ship->thrusting && thrust_frame) {
+		r += SHIP_ROTATIONS;
+		thrust_frame = 0;
+	} else {
+		thrust_frame = 1;
+	}
+	last_ship = ship_sprites + pgm_read_word(&ship_sprites_frames[r]);
+	last_ship_x = floor(ship->origin.x + 0.5);
+	last_ship_y = floor(ship->origin.y + 0.5);
+	display_sprite(last_ship, last_ship_x, last_ship_y, palette);
+	latency_photon(LAT_SHIP);
+}
+
+/*
+ * Draws all bullets present on the screen.
+ */
+void draw_bullets(const Game *g) {
+	uint8_t i;
+	for (i = bullet_last_l; i != bullet_last_h; i=(i+1)%NO_BULLETS) {
+		draw_pixel(last_bullets[i].x, last_bullets[i].y, BLACK);
+	}
+
+	for (i = g->bullet_l; i != g->bullet_h; i=(i+1)%NO_BULLETS) {
+		draw_pixel(g->bullets[i].x, g->bullets[i].y, WHITE);
+	}
+	latency_photon(LAT_FIRE);
+
+	bullet_last_l = g->bullet_l;
+	bullet_last_h = g->bullet_h;
+	for (i = g->bullet_l; i != g->bullet_h; i=(i+1)%NO_BULLETS) {
+		last_bullets[i] = g->bullets[i];
+	}
+}
+
+/*
+ * Draws the debris present on the screen. Debris is the first thing to go
+ * when the frame is over budget: only every second or fourth particle is
+ * drawn, or none at all.
+ */
+void draw_debris(const Game *g) {
+	uint8_t i;
+	for (i = 0; i < NO_DEBRIS; i++) {
+		if (debris_drawn & (1 << i)) {
+			draw_pixel(last_debris[i].x, last_debris[i].y, BLACK);
+			budget_left -= (budget_left < PIXEL_COST)?budget_left:PIXEL_COST;
+		}
+	}
+	debris_drawn = 0;
+
+	// Every stride'th particle from the oldest, which is as many as are paid
+	// for wherever the stack starts.
+	uint8_t n = game_debris(g);
+	uint8_t stride = 1, k = 0;
+	while (stride <= 4 && !spend((n + stride - 1) / stride * PIXEL_COST))
+		stride <<= 1;
+	if (stride > 4)
+		return;
+
+	for (i = g->debris_l; i != g->debris_h; i=(i+1)%NO_DEBRIS, k++) {
+		if (k % stride == 0) {
+			draw_pixel(g->debris[i].x, g->debris[i].y, WHITE);
+			last_debris[i] = g->debris[i];
+			debris_drawn |= 1 << i;
+		}
+	}
+}
+
+/*
+ * Approximate bus cost of draw_outline_rectangle for a square of side size.
+ */
+uint16_t rect_cost(uint8_t size) {
+	return 22 + 30 * (uint16_t) size;
+}
+
+/*
+ * Erases asteroid i at its last drawn position, in whatever form it was drawn.
+ */
+void erase_asteroid(uint8_t i) {
+	Asteroid *a = &last_asteroids[i];
+	if (asteroid_drawn[i] == DRAWN_FULL) {
+		draw_outline_rectangle(a->origin.x, a->origin.y, a->size, a->size,
+			BLACK);
+	} else if (asteroid_drawn[i] == DRAWN_CORNERS) {
+		draw_pixel(a->origin.x, a->origin.y, BLACK);
+		draw_pixel(a->origin.x + a->size, a->origin.y, BLACK);
+		draw_pixel(a->origin.x, a->origin.y + a->size, BLACK);
+		draw_pixel(a->origin.x + a->size, a->origin.y + a->size, BLACK);
+	}
+	asteroid_drawn[i] = DRAWN_NONE;
+}
+
+/*
+ * Draws the asteroids with whatever budget is left, starting from where the
+ * last frame ran out. An asteroid that cannot be redrawn in full gets corner
+ * marks only; one that cannot even afford those is left where it is on
+ * screen until a later frame.
+ */
+void draw_asteroids(const Game *g) {
+	uint8_t i, n;
+	uint8_t next_rr = asteroid_rr;
+	uint8_t starved = 0;
+
+	for (n = 0, i = asteroid_rr; n < NO_ASTEROIDS;
+			n++, i = (i+1)%NO_ASTEROIDS) {
+		uint16_t erase = 0;
+		if (asteroid_drawn[i] == DRAWN_FULL)
+			erase = rect_cost(last_asteroids[i].size);
+		else if (asteroid_drawn[i] == DRAWN_CORNERS)
+			erase = CORNER_COST;
+
+		uint8_t mode = DRAWN_NONE;
+		if (g->asteroids[i].size == 0) {
+			if (!spend(erase))
+				goto deferred;
+		} else if (spend(erase + rect_cost(g->asteroids[i].size))) {
+			mode = DRAWN_FULL;
+		} else if (spend(erase + CORNER_COST)) {
+			mode = DRAWN_CORNERS;
+		} else {
+			goto deferred;
+		}
+
+		erase_asteroid(i);
+		const Asteroid *a = &g->asteroids[i];
+		if (mode == DRAWN_FULL) {
+			draw_outline_rectangle(a->origin.x, a->origin.y, a->size, a->size,
+				WHITE);
+		} else if (mode == DRAWN_CORNERS) {
+			draw_pixel(a->origin.x, a->origin.y, WHITE);
+			draw_pixel(a->origin.x + a->size, a->origin.y, WHITE);
+			draw_pixel(a->origin.x, a->origin.y + a->size, WHITE);
+			draw_pixel(a->origin.x + a->size, a->origin.y + a->size, WHITE);
+		}
+		last_asteroids[i] = *a;
+		asteroid_drawn[i] = mode;
+		if (mode != DRAWN_CORNERS)
+			continue;
+
+	deferred:
+		if (!starved) {
+			next_rr = i;
+			starved = 1;
+		}
+	}
+
+	asteroid_rr = next_rr;
+}
+
+/*
+ * Draws all wreckage present on the screen.
+ */
+void draw_wreckage(const Game *g) {
+	if (g->ship.state != DEAD)
+		return;
+
+	uint8_t i;
+	for (i = 0; i < NO_WRECKAGE; i++) {
+		draw_line(last_wreckages[i].points[0].x, last_wreckages[i].points[0].y,
+				last_wreckages[i].points[1].x, last_wreckages[i].points[1].y, BLACK);
+	}
+
+	if (g->wreckage_life == 0)
+		return;
+
+	for (i = 0; i < NO_WRECKAGE; i++) {
+		draw_line(g->wreckages[i].points[0].x, g->wreckages[i].points[0].y,
+			g->wreckages[i].points[1].x, g->wreckages[i].points[1].y, WHITE);
+		last_wreckages[i] = g->wreckages[i];
+	}
+}
+
+/*
+ * LCD bus bytes it would take to erase and redraw everything this frame
+ * with no budget, from the same cost model render() spends against.
+ * Draws nothing.
+ */
+uint16_t render_cost(const Game *g) {
+	uint32_t cost = HUD_COST + SHIP_COST + 2 * PIXEL_COST * game_bullets(g)
+		+ 2 * PIXEL_COST * game_debris(g);
+	uint8_t i;
+	if (g->ship.state == DEAD)
+		cost += WRECKAGE_COST;
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		if (g->asteroids[i].size > 0)
+			cost += 2 * rect_cost(g->asteroids[i].size);
+	return cost < UINT16_MAX ? cost : UINT16_MAX;
+}
+
+/*
+ * Marks the score cells under anything on screen, which drawing or erasing
+ * it this frame may spoil.
+ */
+void damage_hud(const Game *g) {
+	uint8_t i;
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		if (asteroid_drawn[i] != DRAWN_NONE)
+			hud_damage(&score_hud, last_asteroids[i].origin.x,
+				last_asteroids[i].origin.y, last_asteroids[i].size,
+				last_asteroids[i].size);
+	for (i = bullet_last_l; i != bullet_last_h; i=(i+1)%NO_BULLETS)
+		hud_damage(&score_hud, last_bullets[i].x, last_bullets[i].y, 1, 1);
+	for (i = 0; i < NO_DEBRIS; i++)
+		if (debris_drawn & (1 << i))
+			hud_damage(&score_hud, last_debris[i].x, last_debris[i].y, 1, 1);
+
+	if (last_ship) {
+		int16_t x = last_ship_x, y = last_ship_y;
+		uint8_t w, h;
+		sprite_box(last_ship, &x, &y, &w, &h);
+		hud_damage(&score_hud, x, y, w, h);
+	}
+
+	for (i = 0; g->ship.state == DEAD && i < NO_WRECKAGE; i++) {
+		const Wreckage *w = &last_wreckages[i];
+		int16_t x0 = w->points[0].x, y0 = w->points[0].y;
+		int16_t x1 = w->points[1].x, y1 = w->points[1].y;
+		hud_damage(&score_hud, (x0 < x1 ? x0 : x1) - 1, (y0 < y1 ? y0 : y1) - 1,
+			(x0 < x1 ? x1 - x0 : x0 - x1) + 2, (y0 < y1 ? y1 - y0 : y0 - y1) + 2);
+	}
+}
+
+/*
+ * Draws the game on the screen
+ */
+void render(const Game *g) {
+	budget_left = render_budget;
+
+	// The HUD, ship, wreckage and bullets are always drawn. The score only
+	// redraws the cells that changed or that what moves off them spoils.
+	damage_hud(g);
+	uint16_t fixed = GLYPH_COST * hud_changes(&score_hud, g->score)
+		+ SHIP_COST + 2 * PIXEL_COST * game_bullets(g);
+	if (g->ship.state == DEAD)
+		fixed += WRECKAGE_COST;
+	budget_left -= (fixed < budget_left)?fixed:budget_left;
+
+	TRACE_BEGIN(TR_DRAW_WRECKAGE);
+	draw_wreckage(g);
+	TRACE_END(TR_DRAW_WRECKAGE);
+	TRACE_BEGIN(TR_DRAW_SHIP);
+	draw_ship(&g->ship);
+	TRACE_END(TR_DRAW_SHIP);
+	TRACE_BEGIN(TR_DRAW_BULLETS);
+	draw_bullets(g);
+	TRACE_END(TR_DRAW_BULLETS);
+	TRACE_BEGIN(TR_DRAW_DEBRIS);
+	draw_debris(g);
+	TRACE_END(TR_DRAW_DEBRIS);
+	TRACE_BEGIN(TR_DRAW_ASTEROIDS);
+	draw_asteroids(g);
+	TRACE_END(TR_DRAW_ASTEROIDS);
+
+	// Last, so it is drawn over anything that has wandered across it.
+	TRACE_BEGIN(TR_DRAW_HUD);
+	damage_hud(g);
+	hud_number(&score_hud, g->score);
+	TRACE_END(TR_DRAW_HUD);
+}
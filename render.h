@@ -0,0 +1,25 @@
+/*
+ * Draws a Game through the lcd library, erasing only what moved and
+ * fitting each frame into a budget of LCD bus bytes.
+ */
+
+#include <stdint.h>
+#include "game.h"
+
+// Render budget, in bytes written to the LCD bus per frame.
+#define BUDGET_MIN 2000
+#define BUDGET_MAX 40000
+#define BUDGET_STEP 500
+#define PIXEL_COST 13 // 3 commands + 10 data bytes per draw_pixel.
+#define CORNER_COST (4*PIXEL_COST)
+#define SHIP_COST 1000 // Erase and redraw of the biggest ship frame.
+#define WRECKAGE_COST 1100
+#define GLYPH_COST 107 // A glyph on its own; 96 more for each in a run.
+#define HUD_COST 1180 // Redrawing the whole score line, 12 glyphs.
+
+extern uint16_t render_budget;
+extern uint16_t budget_left;
+
+void render_reset();
+void render(const Game *g);
+uint16_t render_cost(const Game *g);
@@ -0,0 +1,106 @@
+#include "replay.h"
+
+void replay_enc_init(ReplayEnc *e) {
+	e->held = 0;
+	e->run = 0;
+}
+
+/*
+ * Writes out the ticks in the current run, if any. Returns the number of
+ * bytes put in out (0 or 1).
+ */
+uint8_t replay_flush(ReplayEnc *e, uint8_t *out) {
+	if (e->run == 0)
+		return 0;
+	out[0] = e->run - 1;
+	e->run = 0;
+	return 1;
+}
+
+/*
+ * Adds one tick of input. Returns the number of bytes put in out, which
+ * needs room for 3.
+ */
+uint8_t replay_encode(ReplayEnc *e, const GameInput *in, uint8_t *out) {
+	uint8_t f = 0, n;
+
+	if (in->held & INPUT_THRUST)
+		f |= REPLAY_F_THRUST;
+	if (in->held & INPUT_RIGHT)
+		f |= REPLAY_F_RIGHT;
+	if (in->held & INPUT_LEFT)
+		f |= REPLAY_F_LEFT;
+	if (in->pressed & INPUT_FIRE)
+		f |= REPLAY_F_FIRE;
+
+	if (f == e->held && in->turn == 0) {
+		if (++e->run == REPLAY_RUN_MAX)
+			return replay_flush(e, out);
+		return 0;
+	}
+	n = replay_flush(e, out);
+	if (in->turn) {
+		out[n++] = REPLAY_TURN | f;
+		out[n++] = in->turn;
+	} else {
+		out[n++] = REPLAY_TICK | f;
+	}
+	e->held = f & REPLAY_F_HELD;
+	return n;
+}
+
+/*
+ * Starts decoding the stream after the header at REPLAY_ADDR.
+ */
+void replay_dec_init(ReplayDec *d, uint8_t (*read)(uint16_t addr)) {
+	d->read = read;
+	d->pos = REPLAY_ADDR + sizeof(replay_header);
+	d->held = 0;
+	d->run = 0;
+}
+
+static uint8_t held_buttons(uint8_t f) {
+	uint8_t held = 0;
+	if (f & REPLAY_F_THRUST)
+		held |= INPUT_THRUST;
+	if (f & REPLAY_F_RIGHT)
+		held |= INPUT_RIGHT;
+	if (f & REPLAY_F_LEFT)
+		held |= INPUT_LEFT;
+	return held;
+}
+
+/*
+ * Fills in the next tick's input. Returns 0 at the end of the recording,
+ * or at a code it does not know.
+ */
+uint8_t replay_next(ReplayDec *d, GameInput *in) {
+	uint8_t c;
+
+	in->turn = 0;
+	in->pressed = 0;
+	if (d->run == 0) {
+		if (d->pos >= REPLAY_END)
+			return 0;
+		c = d->read(d->pos++);
+		if (c < REPLAY_RUN) {
+			d->run = c + 1;
+		} else if ((c & 0xE0) == REPLAY_TICK) {
+			if ((c & 0xF0) == REPLAY_TURN) {
+				if (d->pos >= REPLAY_END)
+					return 0;
+				in->turn = (int8_t) d->read(d->pos++);
+			}
+			d->held = c & REPLAY_F_HELD;
+			in->held = held_buttons(d->held);
+			if (c & REPLAY_F_FIRE)
+				in->pressed = INPUT_FIRE;
+			return 1;
+		} else {
+			return 0;
+		}
+	}
+	d->run--;
+	in->held = held_buttons(d->held);
+	return 1;
+}
@@ -0,0 +1,72 @@
+/*
+ * Replay format: the seed a game started from plus the input it got, one
+ * GameInput per physics step, packed small enough for minutes of play to
+ * fit in EEPROM. Shared with the host tools, so it must stay free of AVR
+ * code.
+ *
+ * Layout, at REPLAY_ADDR: replay_header, then the code stream up to an
+ * END byte. Only the input game_step() looks at is kept: THRUST, RIGHT
+ * and LEFT held, FIRE pressed and the rotary turn. Codes:
+ *
+ *   0nnnnnnn       n+1 ticks holding the same buttons, no fire, no turn
+ *   1000ffff       one tick of flags f (REPLAY_F_*), no turn
+ *   1001ffff t     one tick of flags f, turned t detents (signed)
+ *   11111111       end of the recording
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdint.h>
+#include "game.h"
+
+// EEPROM below REPLAY_ADDR holds the EEMEM variables (boot_count).
+#define REPLAY_ADDR 0x010
+#define REPLAY_END  0xE00 // First byte past the replay area.
+
+#define REPLAY_MAGIC   0x5052 // "RP"
+#define REPLAY_VERSION 1
+#define REPLAY_UNKNOWN 0xFFFF // ticks and score of an unfinished recording.
+
+#define REPLAY_STRESS 0x01 // replay_header.flags: game.stress was on.
+
+#define REPLAY_F_THRUST 0x01
+#define REPLAY_F_RIGHT  0x02
+#define REPLAY_F_LEFT   0x04
+#define REPLAY_F_FIRE   0x08
+#define REPLAY_F_HELD   0x07
+
+#define REPLAY_RUN     0x80 // Codes below this are runs.
+#define REPLAY_RUN_MAX 128
+#define REPLAY_TICK    0x80
+#define REPLAY_TURN    0x90
+#define REPLAY_END_CODE 0xFF
+
+typedef struct {
+	uint16_t magic;
+	uint8_t version;
+	uint8_t flags;
+	uint16_t seed;
+	uint16_t ticks; // Ticks recorded, as of the last sync.
+	uint16_t score; // Score then, to check a playback against.
+} __attribute__((packed)) replay_header;
+
+typedef struct {
+	uint8_t held; // REPLAY_F_HELD bits of the last tick.
+	uint8_t run;  // Ticks not yet written out as a run.
+} ReplayEnc;
+
+typedef struct {
+	uint8_t (*read)(uint16_t addr); // Fetches a byte of the stream.
+	uint16_t pos;
+	uint8_t held;
+	uint8_t run;
+} ReplayDec;
+
+void replay_enc_init(ReplayEnc *e);
+uint8_t replay_encode(ReplayEnc *e, const GameInput *in, uint8_t *out);
+uint8_t replay_flush(ReplayEnc *e, uint8_t *out);
+void replay_dec_init(ReplayDec *d, uint8_t (*read)(uint16_t addr));
+uint8_t replay_next(ReplayDec *d, GameInput *in);
+
+#endif
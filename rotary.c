@@ -0,0 +1,73 @@
+#include "rotary.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/*
+ * Step for each (previous state << 2 | new state) transition, where a state
+ * is (A << 1 | B). Invalid transitions (both lines changed) are left to the
+ * interrupt, which takes them as two steps the way it was last turning.
+ */
+const int8_t transitions[16] = {
+	 0, -1,  1,  0,
+	 1,  0,  0, -1,
+	-1,  0,  0,  1,
+	 0,  1, -1,  0
+};
+
+uint8_t rotary_state;
+int8_t rotary_dir = 0; // Last valid step, +1 or -1.
+volatile int16_t rotary_steps = 0;
+
+static uint8_t read_rotary() {
+	uint8_t pins = PINE;
+	return ((pins >> ROTARY_A) & 1) << 1 | ((pins >> ROTARY_B) & 1);
+}
+
+void init_rotary() {
+	// Enable encoder reading pull-ups.
+	DDRE &= ~(_BV(ROTARY_A) | _BV(ROTARY_B));
+	PORTE |= _BV(ROTARY_A) | _BV(ROTARY_B);
+	
+	rotary_state = read_rotary();
+	
+	/* Any edge on either line */
+	EICRB = (EICRB & ~(_BV(ISC41) | _BV(ISC51))) | _BV(ISC40) | _BV(ISC50);
+	EIFR = _BV(INTF4) | _BV(INTF5);
+	EIMSK |= _BV(INT4) | _BV(INT5);
+}
+
+/*
+ * Both lines changing at once means an edge came while another interrupt
+ * held this one off, so two steps went by; they are counted in the last
+ * direction seen rather than dropped.
+ */
+ISR(INT4_vect) {
+	uint8_t s = read_rotary();
+	int8_t step = transitions[rotary_state << 2 | s];
+	if (step)
+		rotary_dir = step;
+	else if ((rotary_state ^ s) == 3)
+		step = 2 * rotary_dir;
+	rotary_steps += step;
+	rotary_state = s;
+}
+
+ISR(INT5_vect, ISR_ALIASOF(INT4_vect));
+
+/*
+ * Whole detents turned since the last call, positive clockwise. Part turns
+ * are kept for next time.
+ */
+int8_t rotary_delta() {
+	int16_t detents;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		detents = rotary_steps / ROTARY_STEPS_PER_DETENT;
+		rotary_steps -= detents * ROTARY_STEPS_PER_DETENT;
+	}
+	if (detents > 127)
+		detents = 127;
+	if (detents < -127)
+		detents = -127;
+	return detents;
+}
@@ -0,0 +1,12 @@
+/*
+ * Quadrature decoder for the LaFortuna's rotary encoder (PE4/PE5, INT4/INT5).
+ */
+
+#include <stdint.h>
+
+#define ROTARY_A PE4
+#define ROTARY_B PE5
+#define ROTARY_STEPS_PER_DETENT 4
+
+void init_rotary();
+int8_t rotary_delta();
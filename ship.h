@@ -0,0 +1,655 @@
+/* 64 28x28 sprites from tools/ship.ppm, by tools/sprite565: 7632 bytes, 2033 spans. */
+
+#include <avr/pgmspace.h>
+
+#define SHIP_SPRITES_FRAMES 64
+
+const uint8_t ship_sprites[] PROGMEM = {
+	0x0d, 0x13, 0x06, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x05, 0x01, 0x00, 0x01,
+	0x05, 0x02, 0x10, 0x01, 0x05, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00, 0x06,
+	0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x04, 0x01,
+	0x00, 0x07, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00,
+	0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x02, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02,
+	0x0a, 0x90, 0x02, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x0c, 0x14, 0x08, 0x0a,
+	0x01, 0xff, 0xff, 0x01, 0x09, 0x01, 0x00, 0x01, 0x08, 0x02, 0x10, 0x02,
+	0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x02, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00,
+	0x09, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x05,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x02, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0a,
+	0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x01,
+	0x00, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x03, 0x04, 0x30, 0x0b,
+	0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x05, 0x40, 0x02, 0x00, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00,
+	0x01, 0x0b, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x0d, 0x14, 0x09, 0x0a,
+	0x01, 0xff, 0xff, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01,
+	0x0a, 0x02, 0x10, 0x02, 0x09, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x08,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x02, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0b,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x02, 0x03, 0x20, 0x0b, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x00, 0x05, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x03,
+	0x00, 0x01, 0x00, 0x07, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x01, 0x09, 0x03,
+	0x20, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0b, 0x01,
+	0x00, 0x01, 0x0a, 0x01, 0x00, 0x0f, 0x14, 0x09, 0x0a, 0x01, 0xff, 0xff,
+	0x01, 0x0e, 0x01, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x01, 0x0c, 0x02, 0x10,
+	0x02, 0x0b, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10, 0x0d,
+	0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x07, 0x01,
+	0x00, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02,
+	0x05, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x03, 0x02, 0x10, 0x0b, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00,
+	0x03, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x04, 0x02,
+	0x10, 0x0a, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x07, 0x02, 0x10, 0x0a, 0x01, 0x00, 0x01, 0x09, 0x02, 0x10, 0x01, 0x09,
+	0x02, 0x10, 0x01, 0x09, 0x01, 0x00, 0x01, 0x09, 0x01, 0x00, 0x01, 0x08,
+	0x01, 0x00, 0x11, 0x12, 0x09, 0x08, 0x01, 0xff, 0xff, 0x01, 0x0f, 0x02,
+	0x10, 0x01, 0x0d, 0x03, 0x20, 0x02, 0x0b, 0x02, 0x10, 0x0e, 0x01, 0x00,
+	0x02, 0x09, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x02, 0x07, 0x02, 0x10, 0x0d,
+	0x01, 0x00, 0x02, 0x05, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x02,
+	0x10, 0x0c, 0x01, 0x00, 0x02, 0x01, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x03,
+	0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x03, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x05, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x01, 0x08, 0x01, 0x00,
+	0x01, 0x08, 0x02, 0x10, 0x01, 0x07, 0x01, 0x00, 0x01, 0x06, 0x01, 0x00,
+	0x12, 0x10, 0x09, 0x06, 0x01, 0xff, 0xff, 0x01, 0x0e, 0x04, 0x30, 0x02,
+	0x0a, 0x04, 0x30, 0x10, 0x01, 0x00, 0x02, 0x07, 0x03, 0x20, 0x0f, 0x01,
+	0x00, 0x02, 0x03, 0x04, 0x30, 0x0e, 0x01, 0x00, 0x02, 0x00, 0x03, 0x20,
+	0x0d, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x03,
+	0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x09,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x06, 0x01,
+	0x00, 0x08, 0x01, 0x00, 0x01, 0x07, 0x01, 0x00, 0x01, 0x06, 0x01, 0x00,
+	0x01, 0x05, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x13, 0x0c, 0x09, 0x04,
+	0x01, 0xff, 0xff, 0x01, 0x00, 0x13, 0xf0, 0x20, 0x01, 0x10, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0e,
+	0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x02, 0x10, 0x02, 0x03, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x07, 0x02,
+	0x10, 0x01, 0x05, 0x02, 0x10, 0x01, 0x05, 0x01, 0x00, 0x01, 0x03, 0x02,
+	0x10, 0x13, 0x0d, 0x09, 0x05, 0x01, 0xff, 0xff, 0x01, 0x00, 0x06, 0x50,
+	0x01, 0x06, 0x06, 0x50, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x06, 0x50, 0x02,
+	0x03, 0x01, 0x00, 0x11, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x0f, 0x02,
+	0x10, 0x02, 0x03, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00,
+	0x0b, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x04,
+	0x01, 0x00, 0x08, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00, 0x06, 0x02, 0x10,
+	0x01, 0x04, 0x02, 0x10, 0x01, 0x03, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00,
+	0x13, 0x0d, 0x08, 0x06, 0x01, 0xff, 0xff, 0x01, 0x01, 0x03, 0x20, 0x01,
+	0x04, 0x03, 0x20, 0x02, 0x03, 0x01, 0x00, 0x07, 0x03, 0x20, 0x02, 0x03,
+	0x01, 0x00, 0x0a, 0x03, 0x20, 0x02, 0x03, 0x01, 0x00, 0x0d, 0x03, 0x20,
+	0x02, 0x03, 0x01, 0x00, 0x10, 0x03, 0x20, 0x02, 0x03, 0x01, 0x00, 0x0f,
+	0x03, 0x20, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x03, 0x20, 0x02, 0x03, 0x01,
+	0x00, 0x0a, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x07, 0x03, 0x20, 0x01,
+	0x03, 0x04, 0x30, 0x01, 0x01, 0x03, 0x20, 0x01, 0x00, 0x01, 0x00, 0x14,
+	0x0c, 0x0a, 0x08, 0x01, 0xff, 0xff, 0x01, 0x04, 0x01, 0x00, 0x01, 0x05,
+	0x02, 0x10, 0x01, 0x07, 0x02, 0x10, 0x02, 0x05, 0x01, 0x00, 0x09, 0x02,
+	0x10, 0x02, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00,
+	0x0c, 0x02, 0x10, 0x02, 0x05, 0x01, 0x00, 0x0e, 0x02, 0x10, 0x02, 0x04,
+	0x01, 0x00, 0x10, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00, 0x12, 0x01, 0x00,
+	0x02, 0x04, 0x01, 0x00, 0x0d, 0x07, 0x60, 0x02, 0x04, 0x01, 0x00, 0x07,
+	0x06, 0x50, 0x01, 0x00, 0x07, 0x60, 0x14, 0x0d, 0x0a, 0x09, 0x01, 0xff,
+	0xff, 0x01, 0x05, 0x01, 0x00, 0x01, 0x06, 0x01, 0x00, 0x01, 0x07, 0x01,
+	0x00, 0x02, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00,
+	0x09, 0x02, 0x10, 0x02, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x05,
+	0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0d, 0x01, 0x00,
+	0x02, 0x04, 0x01, 0x00, 0x0e, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x10,
+	0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x11, 0x01, 0x00, 0x01, 0x00, 0x13,
+	0xf0, 0x20, 0x01, 0x13, 0x01, 0x00, 0x12, 0x0f, 0x0a, 0x09, 0x01, 0xff,
+	0xff, 0x01, 0x06, 0x01, 0x00, 0x01, 0x07, 0x01, 0x00, 0x01, 0x08, 0x01,
+	0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00,
+	0x0a, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x05,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00,
+	0x03, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x01,
+	0x03, 0x20, 0x0e, 0x01, 0x00, 0x02, 0x03, 0x05, 0x40, 0x0e, 0x01, 0x00,
+	0x02, 0x08, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x0b, 0x04, 0x30, 0x10,
+	0x01, 0x00, 0x01, 0x0f, 0x03, 0x20, 0x01, 0x11, 0x01, 0x00, 0x11, 0x11,
+	0x0a, 0x09, 0x01, 0xff, 0xff, 0x01, 0x08, 0x01, 0x00, 0x01, 0x09, 0x01,
+	0x00, 0x01, 0x09, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x02, 0x07, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0b,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x00, 0x02,
+	0x10, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x02, 0x02, 0x10, 0x0c,
+	0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x0d, 0x01, 0x00,
+	0x02, 0x06, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x08, 0x02, 0x10, 0x0e,
+	0x01, 0x00, 0x02, 0x0a, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x02, 0x0c, 0x02,
+	0x10, 0x0f, 0x01, 0x00, 0x01, 0x0e, 0x02, 0x10, 0x01, 0x10, 0x01, 0x00,
+	0x01, 0x10, 0x01, 0x00, 0x10, 0x12, 0x0a, 0x09, 0x01, 0xff, 0xff, 0x01,
+	0x0a, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x02,
+	0x08, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0b, 0x01,
+	0x00, 0x03, 0x00, 0x02, 0x10, 0x05, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x03,
+	0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x03, 0x01,
+	0x00, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02,
+	0x05, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0d, 0x01,
+	0x00, 0x02, 0x08, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x09, 0x01, 0x00,
+	0x0d, 0x01, 0x00, 0x02, 0x0a, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x0c,
+	0x01, 0x00, 0x0e, 0x01, 0x00, 0x01, 0x0d, 0x02, 0x10, 0x01, 0x0e, 0x01,
+	0x00, 0x01, 0x0f, 0x01, 0x00, 0x0e, 0x13, 0x0a, 0x09, 0x01, 0xff, 0xff,
+	0x01, 0x0c, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x0a, 0x03, 0x20,
+	0x03, 0x00, 0x01, 0x00, 0x08, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x03, 0x01,
+	0x01, 0x00, 0x06, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x02, 0x02, 0x04, 0x30,
+	0x0c, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x04,
+	0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00,
+	0x02, 0x05, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0c,
+	0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x08, 0x01,
+	0x00, 0x0c, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02,
+	0x09, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x0a, 0x01, 0x00, 0x0c, 0x01,
+	0x00, 0x01, 0x0b, 0x02, 0x10, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x0d, 0x01,
+	0x00, 0x0c, 0x13, 0x08, 0x09, 0x01, 0xff, 0xff, 0x01, 0x0b, 0x01, 0x00,
+	0x01, 0x0b, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02,
+	0x00, 0x01, 0x00, 0x07, 0x05, 0x40, 0x02, 0x01, 0x06, 0x50, 0x0b, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00,
+	0x0a, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x03,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0a,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01,
+	0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+	0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x01, 0x08, 0x02, 0x10, 0x01, 0x08, 0x01, 0x00, 0x0c, 0x13, 0x06,
+	0x08, 0x01, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
+	0x0b, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x01,
+	0x0b, 0xa0, 0x02, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x02, 0x03, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0x08, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x04,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00,
+	0x02, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x07,
+	0x01, 0x00, 0x01, 0x05, 0x02, 0x10, 0x01, 0x05, 0x02, 0x10, 0x01, 0x06,
+	0x01, 0x00, 0x0d, 0x14, 0x06, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x02, 0x01, 0x06, 0x50, 0x0c, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00,
+	0x07, 0x05, 0x40, 0x02, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x02,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x09,
+	0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x02, 0x01,
+	0x00, 0x07, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x06, 0x01,
+	0x00, 0x02, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x01, 0x03, 0x02, 0x10, 0x01, 0x04, 0x01, 0x00, 0x0d,
+	0x14, 0x05, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+	0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x04, 0x30, 0x02, 0x01,
+	0x01, 0x00, 0x05, 0x02, 0x10, 0x03, 0x01, 0x01, 0x00, 0x07, 0x02, 0x10,
+	0x0c, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x03, 0x20, 0x02, 0x01,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00,
+	0x02, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x08,
+	0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02,
+	0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x04, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x02, 0x10,
+	0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x12, 0x06, 0x0a,
+	0x01, 0xff, 0xff, 0x01, 0x04, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x01,
+	0x04, 0x01, 0x00, 0x01, 0x04, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x06,
+	0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x03, 0x03, 0x01,
+	0x00, 0x09, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x0b,
+	0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0c, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x0a, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x09,
+	0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x05, 0x02, 0x10, 0x02,
+	0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x01,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x00, 0x02, 0x10,
+	0x11, 0x11, 0x08, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x09, 0x01, 0x00, 0x01,
+	0x08, 0x01, 0x00, 0x01, 0x07, 0x02, 0x10, 0x01, 0x07, 0x02, 0x10, 0x02,
+	0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0a, 0x01,
+	0x00, 0x02, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00,
+	0x0c, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x10, 0x01,
+	0x00, 0x02, 0x04, 0x01, 0x00, 0x0e, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00,
+	0x0c, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x0a, 0x02, 0x10, 0x02, 0x02,
+	0x01, 0x00, 0x08, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x06, 0x02, 0x10,
+	0x02, 0x01, 0x01, 0x00, 0x04, 0x02, 0x10, 0x01, 0x01, 0x03, 0x20, 0x01,
+	0x00, 0x02, 0x10, 0x12, 0x10, 0x09, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x0b,
+	0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x01, 0x09,
+	0x02, 0x10, 0x02, 0x08, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x07, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02,
+	0x06, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0d, 0x01,
+	0x00, 0x02, 0x04, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00,
+	0x0e, 0x04, 0x30, 0x02, 0x03, 0x01, 0x00, 0x0b, 0x04, 0x30, 0x02, 0x02,
+	0x01, 0x00, 0x08, 0x03, 0x20, 0x02, 0x01, 0x01, 0x00, 0x04, 0x04, 0x30,
+	0x01, 0x00, 0x04, 0x30, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0e, 0x0a, 0x0a,
+	0x01, 0xff, 0xff, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x0e, 0x01, 0x00, 0x01,
+	0x0d, 0x01, 0x00, 0x01, 0x0b, 0x02, 0x10, 0x01, 0x0a, 0x03, 0x20, 0x02,
+	0x09, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0d, 0x01,
+	0x00, 0x02, 0x07, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x05, 0x02, 0x10,
+	0x0e, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x02, 0x03,
+	0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0f, 0x01, 0x00,
+	0x01, 0x01, 0x12, 0xf0, 0x10, 0x01, 0x00, 0x01, 0x00, 0x13, 0x0c, 0x0a,
+	0x08, 0x01, 0xff, 0xff, 0x01, 0x0f, 0x02, 0x10, 0x01, 0x0d, 0x02, 0x10,
+	0x01, 0x0b, 0x03, 0x20, 0x02, 0x09, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02,
+	0x08, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x06, 0x02, 0x10, 0x0d, 0x01,
+	0x00, 0x02, 0x04, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x02, 0x02, 0x10,
+	0x0e, 0x01, 0x00, 0x02, 0x00, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x02, 0x01,
+	0x06, 0x50, 0x0e, 0x01, 0x00, 0x02, 0x07, 0x06, 0x50, 0x0e, 0x01, 0x00,
+	0x01, 0x0d, 0x06, 0x50, 0x13, 0x0d, 0x0a, 0x07, 0x01, 0xff, 0xff, 0x01,
+	0x12, 0x01, 0x00, 0x01, 0x0f, 0x03, 0x20, 0x01, 0x0c, 0x04, 0x30, 0x02,
+	0x09, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x03, 0x20, 0x0f, 0x01,
+	0x00, 0x02, 0x03, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x00, 0x03, 0x20,
+	0x0f, 0x01, 0x00, 0x02, 0x01, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x04,
+	0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x07, 0x03, 0x20, 0x0f, 0x01, 0x00,
+	0x02, 0x0a, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x01, 0x0d, 0x03, 0x20, 0x01,
+	0x10, 0x02, 0x10, 0x14, 0x0d, 0x0a, 0x06, 0x01, 0xff, 0xff, 0x01, 0x13,
+	0x01, 0x00, 0x01, 0x0d, 0x06, 0x50, 0x02, 0x07, 0x06, 0x50, 0x0e, 0x01,
+	0x00, 0x02, 0x01, 0x06, 0x50, 0x0e, 0x01, 0x00, 0x02, 0x00, 0x02, 0x10,
+	0x0e, 0x01, 0x00, 0x02, 0x02, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x02, 0x04,
+	0x02, 0x10, 0x0e, 0x01, 0x00, 0x02, 0x06, 0x02, 0x10, 0x0d, 0x01, 0x00,
+	0x02, 0x08, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10, 0x0d,
+	0x01, 0x00, 0x01, 0x0b, 0x03, 0x20, 0x01, 0x0d, 0x02, 0x10, 0x01, 0x0f,
+	0x01, 0x00, 0x14, 0x0d, 0x0a, 0x05, 0x01, 0xff, 0xff, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x01, 0x12, 0xf0, 0x10, 0x03, 0x02, 0x01, 0x00, 0x0f, 0x01,
+	0x00, 0x13, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x02,
+	0x04, 0x02, 0x10, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0e, 0x01,
+	0x00, 0x02, 0x07, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00,
+	0x0d, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x01, 0x0b,
+	0x02, 0x10, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x01, 0x0e,
+	0x01, 0x00, 0x14, 0x0f, 0x0a, 0x06, 0x01, 0xff, 0xff, 0x02, 0x00, 0x01,
+	0x00, 0x02, 0x03, 0x20, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04, 0x30, 0x02,
+	0x02, 0x01, 0x00, 0x09, 0x03, 0x20, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x04,
+	0x30, 0x02, 0x04, 0x01, 0x00, 0x10, 0x03, 0x20, 0x03, 0x04, 0x01, 0x00,
+	0x0f, 0x01, 0x00, 0x13, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0e, 0x01,
+	0x00, 0x02, 0x06, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00,
+	0x0d, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x08,
+	0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x09, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x01, 0x0a, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x00,
+	0x13, 0x11, 0x09, 0x08, 0x01, 0xff, 0xff, 0x02, 0x00, 0x01, 0x00, 0x02,
+	0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x02, 0x10, 0x02, 0x02, 0x01,
+	0x00, 0x05, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x07, 0x02, 0x10, 0x02,
+	0x03, 0x01, 0x00, 0x09, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x0b, 0x02,
+	0x10, 0x02, 0x04, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00,
+	0x0f, 0x02, 0x10, 0x02, 0x05, 0x01, 0x00, 0x10, 0x03, 0x20, 0x02, 0x05,
+	0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0e, 0x01, 0x00,
+	0x02, 0x06, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0c,
+	0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x08, 0x01,
+	0x00, 0x0a, 0x01, 0x00, 0x01, 0x08, 0x01, 0x00, 0x01, 0x09, 0x01, 0x00,
+	0x10, 0x12, 0x06, 0x09, 0x01, 0xff, 0xff, 0x01, 0x00, 0x02, 0x10, 0x02,
+	0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x01,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00,
+	0x05, 0x02, 0x10, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x0a, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x0c,
+	0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x03, 0x20, 0x03, 0x03, 0x01,
+	0x00, 0x09, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x08,
+	0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x06, 0x02, 0x10,
+	0x02, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x01,
+	0x04, 0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x0d, 0x13, 0x04, 0x0a, 0x01,
+	0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x02, 0x10, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x03, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02,
+	0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
+	0x07, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x08, 0x03, 0x20,
+	0x03, 0x00, 0x01, 0x00, 0x06, 0x02, 0x10, 0x0a, 0x01, 0x00, 0x03, 0x00,
+	0x01, 0x00, 0x04, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00,
+	0x02, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0d, 0x13, 0x05, 0x0a, 0x01, 0xff,
+	0xff, 0x01, 0x03, 0x01, 0x00, 0x01, 0x02, 0x02, 0x10, 0x02, 0x02, 0x01,
+	0x00, 0x04, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02,
+	0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00,
+	0x06, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00,
+	0x02, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09,
+	0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x05, 0x40, 0x03, 0x00, 0x01,
+	0x00, 0x02, 0x04, 0x30, 0x0a, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0b,
+	0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x0d, 0x16, 0x06, 0x0a, 0x01, 0xff, 0xff,
+	0x01, 0x06, 0x01, 0x00, 0x01, 0x05, 0x02, 0x10, 0x01, 0x05, 0x02, 0x10,
+	0x02, 0x05, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x07,
+	0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x04, 0x01,
+	0x00, 0x08, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00,
+	0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x01,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x01, 0x01, 0x0b, 0xa0, 0x04, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x08,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00,
+	0x08, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x07, 0x01,
+	0x00, 0x0c, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x07, 0x01, 0x00, 0x01,
+	0x05, 0x02, 0x10, 0x01, 0x06, 0x01, 0x00, 0x0c, 0x15, 0x08, 0x0a, 0x01,
+	0xff, 0xff, 0x01, 0x09, 0x01, 0x00, 0x01, 0x08, 0x02, 0x10, 0x02, 0x07,
+	0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01, 0x00,
+	0x02, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x09,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x05, 0x01,
+	0x00, 0x0a, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0a, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00,
+	0x0a, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x03, 0x04, 0x30, 0x0b, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x05, 0x40, 0x04, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x01,
+	0x00, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x07,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00,
+	0x0b, 0x01, 0x00, 0x02, 0x04, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x01, 0x05,
+	0x01, 0x00, 0x0c, 0x15, 0x09, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x0b, 0x01,
+	0x00, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0a, 0x02, 0x10, 0x02, 0x09, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02,
+	0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0b, 0x01,
+	0x00, 0x02, 0x06, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00,
+	0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x03,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x02, 0x02, 0x03, 0x20, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x05,
+	0x02, 0x10, 0x0b, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00,
+	0x07, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x09, 0x03,
+	0x20, 0x03, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03,
+	0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x01,
+	0x00, 0x06, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x02, 0x10, 0x0b,
+	0x01, 0x00, 0x01, 0x04, 0x01, 0x00, 0x0f, 0x14, 0x09, 0x0a, 0x01, 0xff,
+	0xff, 0x01, 0x0e, 0x01, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x01, 0x0c, 0x02,
+	0x10, 0x02, 0x0b, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10,
+	0x0d, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x07,
+	0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0c, 0x01, 0x00,
+	0x02, 0x04, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0b,
+	0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x04,
+	0x02, 0x10, 0x0a, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00,
+	0x0a, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x07, 0x02, 0x10, 0x0a, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x07, 0x04, 0x30, 0x03, 0x02, 0x01, 0x00,
+	0x06, 0x01, 0x00, 0x09, 0x02, 0x10, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02,
+	0x10, 0x09, 0x01, 0x00, 0x02, 0x02, 0x02, 0x10, 0x09, 0x01, 0x00, 0x02,
+	0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x11, 0x12, 0x09, 0x08, 0x01, 0xff,
+	0xff, 0x01, 0x0f, 0x02, 0x10, 0x01, 0x0d, 0x03, 0x20, 0x02, 0x0b, 0x02,
+	0x10, 0x0e, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x02,
+	0x07, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x05, 0x02, 0x10, 0x0d, 0x01,
+	0x00, 0x02, 0x03, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x02, 0x01, 0x02, 0x10,
+	0x0c, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x0b, 0x01,
+	0x00, 0x02, 0x03, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00,
+	0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x0a, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x06, 0x02, 0x10, 0x09,
+	0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x04, 0x04, 0x30, 0x09, 0x01, 0x00,
+	0x02, 0x01, 0x03, 0x20, 0x08, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x08,
+	0x02, 0x10, 0x01, 0x07, 0x01, 0x00, 0x01, 0x07, 0x01, 0x00, 0x13, 0x11,
+	0x0a, 0x07, 0x01, 0xff, 0xff, 0x01, 0x12, 0x01, 0x00, 0x01, 0x0f, 0x03,
+	0x20, 0x02, 0x0b, 0x04, 0x30, 0x11, 0x01, 0x00, 0x02, 0x08, 0x03, 0x20,
+	0x10, 0x01, 0x00, 0x02, 0x04, 0x04, 0x30, 0x0f, 0x01, 0x00, 0x02, 0x01,
+	0x03, 0x20, 0x0e, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0d, 0x01, 0x00,
+	0x02, 0x04, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x02, 0x10, 0x0c,
+	0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x03, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x03, 0x01,
+	0x01, 0x00, 0x06, 0x02, 0x10, 0x09, 0x01, 0x00, 0x02, 0x00, 0x08, 0x70,
+	0x09, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x01, 0x07,
+	0x01, 0x00, 0x01, 0x06, 0x01, 0x00, 0x01, 0x05, 0x01, 0x00, 0x15, 0x0e,
+	0x0b, 0x05, 0x01, 0xff, 0xff, 0x01, 0x14, 0x01, 0x00, 0x01, 0x02, 0x12,
+	0xf0, 0x10, 0x01, 0x12, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x11, 0x01,
+	0x00, 0x02, 0x04, 0x01, 0x00, 0x10, 0x01, 0x00, 0x02, 0x04, 0x02, 0x10,
+	0x0e, 0x02, 0x10, 0x03, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x0d, 0x01,
+	0x00, 0x03, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x03,
+	0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x00, 0x08,
+	0x70, 0x09, 0x02, 0x10, 0x01, 0x07, 0x02, 0x10, 0x01, 0x07, 0x01, 0x00,
+	0x01, 0x06, 0x01, 0x00, 0x01, 0x05, 0x01, 0x00, 0x15, 0x0d, 0x0b, 0x05,
+	0x01, 0xff, 0xff, 0x01, 0x02, 0x06, 0x50, 0x01, 0x08, 0x06, 0x50, 0x02,
+	0x05, 0x01, 0x00, 0x0e, 0x06, 0x50, 0x02, 0x04, 0x02, 0x10, 0x13, 0x02,
+	0x10, 0x03, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x11, 0x02, 0x10, 0x03,
+	0x02, 0x01, 0x00, 0x05, 0x01, 0x00, 0x0f, 0x02, 0x10, 0x03, 0x01, 0x01,
+	0x00, 0x06, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x02, 0x00, 0x07, 0x60, 0x0c,
+	0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0a, 0x02, 0x10, 0x02, 0x06, 0x01,
+	0x00, 0x08, 0x02, 0x10, 0x01, 0x06, 0x02, 0x10, 0x01, 0x05, 0x01, 0x00,
+	0x01, 0x04, 0x01, 0x00, 0x16, 0x0d, 0x0b, 0x06, 0x01, 0xff, 0xff, 0x01,
+	0x04, 0x02, 0x10, 0x01, 0x06, 0x03, 0x20, 0x02, 0x06, 0x01, 0x00, 0x09,
+	0x03, 0x20, 0x02, 0x05, 0x02, 0x10, 0x0c, 0x03, 0x20, 0x03, 0x03, 0x02,
+	0x10, 0x06, 0x01, 0x00, 0x0f, 0x03, 0x20, 0x03, 0x01, 0x02, 0x10, 0x06,
+	0x01, 0x00, 0x12, 0x03, 0x20, 0x03, 0x00, 0x02, 0x10, 0x06, 0x01, 0x00,
+	0x13, 0x03, 0x20, 0x03, 0x02, 0x02, 0x10, 0x06, 0x01, 0x00, 0x10, 0x03,
+	0x20, 0x02, 0x04, 0x03, 0x20, 0x0d, 0x03, 0x20, 0x02, 0x06, 0x01, 0x00,
+	0x0a, 0x03, 0x20, 0x01, 0x06, 0x04, 0x30, 0x01, 0x04, 0x03, 0x20, 0x01,
+	0x03, 0x01, 0x00, 0x15, 0x0d, 0x0b, 0x08, 0x01, 0xff, 0xff, 0x01, 0x05,
+	0x01, 0x00, 0x01, 0x06, 0x02, 0x10, 0x01, 0x08, 0x02, 0x10, 0x02, 0x06,
+	0x01, 0x00, 0x0a, 0x02, 0x10, 0x02, 0x00, 0x07, 0x60, 0x0c, 0x01, 0x00,
+	0x03, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x03, 0x02,
+	0x01, 0x00, 0x06, 0x01, 0x00, 0x0f, 0x02, 0x10, 0x03, 0x03, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x11, 0x02, 0x10, 0x02, 0x04, 0x02, 0x10, 0x13, 0x01,
+	0x00, 0x02, 0x05, 0x01, 0x00, 0x0e, 0x07, 0x60, 0x02, 0x05, 0x01, 0x00,
+	0x08, 0x06, 0x50, 0x01, 0x02, 0x06, 0x50, 0x01, 0x01, 0x01, 0x00, 0x15,
+	0x0d, 0x0b, 0x09, 0x01, 0xff, 0xff, 0x01, 0x06, 0x01, 0x00, 0x01, 0x07,
+	0x01, 0x00, 0x01, 0x08, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x02, 0x00, 0x08, 0x70, 0x0a, 0x02, 0x10, 0x03, 0x01, 0x01, 0x00,
+	0x06, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x06, 0x01,
+	0x00, 0x0d, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x0e,
+	0x01, 0x00, 0x02, 0x04, 0x02, 0x10, 0x0f, 0x02, 0x10, 0x02, 0x04, 0x02,
+	0x10, 0x11, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x12,
+	0x01, 0x00, 0x01, 0x02, 0x12, 0xf0, 0x10, 0x01, 0x14, 0x01, 0x00, 0x12,
+	0x0f, 0x0a, 0x09, 0x01, 0xff, 0xff, 0x01, 0x06, 0x01, 0x00, 0x02, 0x00,
+	0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x06, 0x50, 0x08, 0x01, 0x00,
+	0x03, 0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x03, 0x01,
+	0x01, 0x00, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00,
+	0x06, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x03, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x03,
+	0x00, 0x01, 0x00, 0x03, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x01, 0x03,
+	0x20, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x05, 0x40, 0x0e, 0x01, 0x00, 0x02,
+	0x08, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x0b, 0x04, 0x30, 0x10, 0x01,
+	0x00, 0x01, 0x0f, 0x03, 0x20, 0x01, 0x11, 0x01, 0x00, 0x11, 0x11, 0x0a,
+	0x09, 0x01, 0xff, 0xff, 0x02, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02,
+	0x03, 0x03, 0x20, 0x09, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x06, 0x02,
+	0x10, 0x09, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0a,
+	0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x03, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x04, 0x00,
+	0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03,
+	0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x02, 0x02,
+	0x10, 0x0c, 0x01, 0x00, 0x03, 0x02, 0x01, 0x00, 0x04, 0x02, 0x10, 0x0d,
+	0x01, 0x00, 0x02, 0x06, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x02, 0x08, 0x02,
+	0x10, 0x0e, 0x01, 0x00, 0x02, 0x0a, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x02,
+	0x0c, 0x02, 0x10, 0x0f, 0x01, 0x00, 0x01, 0x0e, 0x02, 0x10, 0x01, 0x10,
+	0x01, 0x00, 0x01, 0x10, 0x01, 0x00, 0x10, 0x13, 0x0a, 0x0a, 0x01, 0xff,
+	0xff, 0x01, 0x03, 0x02, 0x10, 0x03, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00,
+	0x0a, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x06, 0x02, 0x10, 0x0a, 0x01,
+	0x00, 0x03, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x03,
+	0x03, 0x01, 0x00, 0x08, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x04, 0x00, 0x01,
+	0x00, 0x03, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x04, 0x01,
+	0x01, 0x00, 0x03, 0x01, 0x00, 0x05, 0x02, 0x10, 0x0b, 0x01, 0x00, 0x02,
+	0x02, 0x03, 0x20, 0x0b, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x01,
+	0x00, 0x02, 0x04, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00,
+	0x0c, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x08,
+	0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10, 0x0d, 0x01, 0x00,
+	0x02, 0x0b, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x0c, 0x01, 0x00, 0x0e,
+	0x01, 0x00, 0x01, 0x0d, 0x02, 0x10, 0x01, 0x0e, 0x01, 0x00, 0x01, 0x0f,
+	0x01, 0x00, 0x0e, 0x15, 0x0a, 0x0b, 0x01, 0xff, 0xff, 0x01, 0x05, 0x01,
+	0x00, 0x01, 0x05, 0x02, 0x10, 0x03, 0x05, 0x01, 0x00, 0x07, 0x01, 0x00,
+	0x0c, 0x01, 0x00, 0x03, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0c, 0x01,
+	0x00, 0x02, 0x05, 0x01, 0x00, 0x09, 0x04, 0x30, 0x04, 0x00, 0x01, 0x00,
+	0x05, 0x01, 0x00, 0x08, 0x02, 0x10, 0x0c, 0x01, 0x00, 0x03, 0x01, 0x01,
+	0x00, 0x05, 0x03, 0x20, 0x0c, 0x01, 0x00, 0x02, 0x02, 0x04, 0x30, 0x0c,
+	0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x01,
+	0x00, 0x0c, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02,
+	0x05, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0c, 0x01,
+	0x00, 0x02, 0x07, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00,
+	0x0c, 0x01, 0x00, 0x02, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x09,
+	0x01, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x0a, 0x01, 0x00, 0x0c, 0x01, 0x00,
+	0x01, 0x0b, 0x02, 0x10, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x0d, 0x01, 0x00,
+	0x0c, 0x15, 0x08, 0x0b, 0x01, 0xff, 0xff, 0x01, 0x04, 0x01, 0x00, 0x01,
+	0x04, 0x02, 0x10, 0x03, 0x04, 0x01, 0x00, 0x06, 0x01, 0x00, 0x0b, 0x01,
+	0x00, 0x03, 0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x04,
+	0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x03, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x07, 0x05, 0x40, 0x02, 0x01,
+	0x06, 0x50, 0x0b, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a,
+	0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x03, 0x01,
+	0x00, 0x0a, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x05, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x09, 0x01,
+	0x00, 0x02, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00,
+	0x09, 0x01, 0x00, 0x02, 0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x07,
+	0x01, 0x00, 0x09, 0x01, 0x00, 0x01, 0x08, 0x02, 0x10, 0x01, 0x08, 0x01,
+	0x00, 0x0d, 0x16, 0x07, 0x0b, 0x01, 0xff, 0xff, 0x01, 0x07, 0x01, 0x00,
+	0x01, 0x06, 0x02, 0x10, 0x02, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x03,
+	0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x04, 0x01, 0x01,
+	0x00, 0x05, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x04, 0x01,
+	0x01, 0x00, 0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x01,
+	0x01, 0x0c, 0xb0, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x02,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x02, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0a,
+	0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x04, 0x01,
+	0x00, 0x09, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+	0x04, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x02, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00,
+	0x08, 0x01, 0x00, 0x01, 0x06, 0x02, 0x10, 0x01, 0x06, 0x02, 0x10, 0x01,
+	0x07, 0x01, 0x00, 0x0d, 0x15, 0x06, 0x0b, 0x01, 0xff, 0xff, 0x01, 0x07,
+	0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x07, 0x02, 0x10, 0x03, 0x01, 0x01,
+	0x00, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x05,
+	0x01, 0x00, 0x08, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00,
+	0x08, 0x01, 0x00, 0x03, 0x01, 0x06, 0x50, 0x08, 0x01, 0x00, 0x0c, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x05, 0x40, 0x02, 0x01, 0x01, 0x00,
+	0x0b, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x02,
+	0x01, 0x00, 0x0a, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x08,
+	0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x03, 0x01,
+	0x00, 0x07, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02,
+	0x03, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x02, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00, 0x01, 0x03, 0x02, 0x10,
+	0x01, 0x04, 0x01, 0x00, 0x0d, 0x15, 0x05, 0x0b, 0x01, 0xff, 0xff, 0x01,
+	0x09, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x08, 0x02, 0x10, 0x03, 0x01,
+	0x01, 0x00, 0x07, 0x01, 0x00, 0x09, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00,
+	0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01, 0x05, 0x40, 0x09, 0x01,
+	0x00, 0x03, 0x01, 0x01, 0x00, 0x04, 0x03, 0x20, 0x09, 0x01, 0x00, 0x03,
+	0x01, 0x01, 0x00, 0x07, 0x03, 0x20, 0x0c, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x09, 0x03, 0x20, 0x02, 0x01, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x02,
+	0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00,
+	0x07, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00,
+	0x02, 0x01, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x03,
+	0x01, 0x00, 0x01, 0x01, 0x02, 0x10, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x0f, 0x13, 0x06, 0x0a, 0x01, 0xff, 0xff, 0x02, 0x04, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x09, 0x03, 0x20, 0x03,
+	0x04, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x04,
+	0x30, 0x0b, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x06, 0x02, 0x10, 0x0b,
+	0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x08, 0x01, 0x00, 0x0b, 0x01, 0x00,
+	0x03, 0x03, 0x01, 0x00, 0x09, 0x03, 0x20, 0x0e, 0x01, 0x00, 0x03, 0x03,
+	0x01, 0x00, 0x0b, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00,
+	0x0c, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x02, 0x02,
+	0x01, 0x00, 0x09, 0x02, 0x10, 0x02, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00,
+	0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x06,
+	0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x04, 0x02, 0x10, 0x02, 0x00, 0x01,
+	0x00, 0x03, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0x01,
+	0x00, 0x02, 0x10, 0x01, 0x00, 0x01, 0x00, 0x11, 0x12, 0x08, 0x0a, 0x01,
+	0xff, 0xff, 0x01, 0x09, 0x01, 0x00, 0x01, 0x08, 0x01, 0x00, 0x02, 0x07,
+	0x02, 0x10, 0x0d, 0x02, 0x10, 0x03, 0x07, 0x02, 0x10, 0x0a, 0x03, 0x20,
+	0x0e, 0x01, 0x00, 0x03, 0x06, 0x01, 0x00, 0x09, 0x01, 0x00, 0x0e, 0x01,
+	0x00, 0x03, 0x06, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x03,
+	0x05, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x02, 0x05, 0x01,
+	0x00, 0x0c, 0x02, 0x10, 0x03, 0x04, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x10,
+	0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x0e, 0x02, 0x10, 0x02, 0x03, 0x01,
+	0x00, 0x0c, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x0a, 0x02, 0x10, 0x02,
+	0x02, 0x01, 0x00, 0x08, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x06, 0x02,
+	0x10, 0x02, 0x01, 0x01, 0x00, 0x04, 0x02, 0x10, 0x01, 0x01, 0x03, 0x20,
+	0x01, 0x00, 0x02, 0x10, 0x01, 0x00, 0x01, 0x00, 0x12, 0x0f, 0x09, 0x0a,
+	0x01, 0xff, 0xff, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01,
+	0x0a, 0x01, 0x00, 0x02, 0x09, 0x02, 0x10, 0x0c, 0x06, 0x50, 0x03, 0x08,
+	0x01, 0x00, 0x0a, 0x02, 0x10, 0x11, 0x01, 0x00, 0x03, 0x07, 0x01, 0x00,
+	0x0b, 0x01, 0x00, 0x10, 0x01, 0x00, 0x03, 0x07, 0x01, 0x00, 0x0b, 0x01,
+	0x00, 0x0f, 0x01, 0x00, 0x03, 0x06, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x0f,
+	0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x02, 0x04, 0x01,
+	0x00, 0x0d, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0e, 0x04, 0x30, 0x02,
+	0x03, 0x01, 0x00, 0x0b, 0x04, 0x30, 0x02, 0x02, 0x01, 0x00, 0x08, 0x03,
+	0x20, 0x02, 0x01, 0x01, 0x00, 0x04, 0x04, 0x30, 0x01, 0x00, 0x04, 0x30,
+	0x15, 0x0d, 0x0a, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x0f, 0x01, 0x00, 0x01,
+	0x0e, 0x01, 0x00, 0x01, 0x0d, 0x01, 0x00, 0x01, 0x0b, 0x02, 0x10, 0x01,
+	0x0a, 0x03, 0x20, 0x02, 0x09, 0x01, 0x00, 0x0c, 0x09, 0x80, 0x03, 0x08,
+	0x01, 0x00, 0x0d, 0x01, 0x00, 0x13, 0x01, 0x00, 0x03, 0x07, 0x01, 0x00,
+	0x0d, 0x01, 0x00, 0x12, 0x01, 0x00, 0x03, 0x05, 0x02, 0x10, 0x0e, 0x01,
+	0x00, 0x11, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x10,
+	0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x02, 0x01,
+	0x00, 0x0f, 0x01, 0x00, 0x01, 0x00, 0x13, 0xf0, 0x20, 0x15, 0x0c, 0x0a,
+	0x08, 0x01, 0xff, 0xff, 0x01, 0x0f, 0x02, 0x10, 0x01, 0x0d, 0x02, 0x10,
+	0x01, 0x0b, 0x03, 0x20, 0x02, 0x09, 0x02, 0x10, 0x0d, 0x02, 0x10, 0x03,
+	0x08, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x0f, 0x06, 0x50, 0x03, 0x06, 0x02,
+	0x10, 0x0d, 0x01, 0x00, 0x13, 0x01, 0x00, 0x03, 0x04, 0x02, 0x10, 0x0d,
+	0x01, 0x00, 0x12, 0x01, 0x00, 0x03, 0x02, 0x02, 0x10, 0x0e, 0x01, 0x00,
+	0x11, 0x01, 0x00, 0x03, 0x00, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x10, 0x01,
+	0x00, 0x02, 0x01, 0x06, 0x50, 0x0e, 0x01, 0x00, 0x02, 0x07, 0x06, 0x50,
+	0x0e, 0x01, 0x00, 0x01, 0x0d, 0x06, 0x50, 0x16, 0x0c, 0x0a, 0x06, 0x01,
+	0xff, 0xff, 0x01, 0x10, 0x03, 0x20, 0x01, 0x0d, 0x03, 0x20, 0x02, 0x0a,
+	0x03, 0x20, 0x0f, 0x01, 0x00, 0x02, 0x07, 0x03, 0x20, 0x0f, 0x02, 0x10,
+	0x03, 0x04, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x11, 0x02, 0x10, 0x03, 0x01,
+	0x03, 0x20, 0x0f, 0x01, 0x00, 0x13, 0x02, 0x10, 0x03, 0x00, 0x03, 0x20,
+	0x0f, 0x01, 0x00, 0x14, 0x02, 0x10, 0x03, 0x03, 0x03, 0x20, 0x0f, 0x01,
+	0x00, 0x12, 0x02, 0x10, 0x02, 0x06, 0x03, 0x20, 0x0f, 0x03, 0x20, 0x02,
+	0x09, 0x03, 0x20, 0x0f, 0x01, 0x00, 0x01, 0x0c, 0x04, 0x30, 0x01, 0x0f,
+	0x03, 0x20, 0x15, 0x0d, 0x0a, 0x06, 0x01, 0xff, 0xff, 0x01, 0x13, 0x01,
+	0x00, 0x01, 0x0d, 0x06, 0x50, 0x02, 0x07, 0x06, 0x50, 0x0e, 0x01, 0x00,
+	0x02, 0x01, 0x06, 0x50, 0x0e, 0x02, 0x10, 0x03, 0x00, 0x02, 0x10, 0x0e,
+	0x01, 0x00, 0x10, 0x01, 0x00, 0x03, 0x02, 0x02, 0x10, 0x0e, 0x01, 0x00,
+	0x11, 0x01, 0x00, 0x03, 0x04, 0x02, 0x10, 0x0e, 0x01, 0x00, 0x12, 0x01,
+	0x00, 0x03, 0x06, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x13, 0x02, 0x10, 0x03,
+	0x08, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x0f, 0x05, 0x40, 0x02, 0x09, 0x02,
+	0x10, 0x0d, 0x01, 0x00, 0x01, 0x0b, 0x03, 0x20, 0x01, 0x0d, 0x02, 0x10,
+	0x01, 0x0f, 0x01, 0x00, 0x15, 0x0d, 0x0a, 0x05, 0x01, 0xff, 0xff, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x01, 0x13, 0xf0, 0x20, 0x02, 0x02, 0x01, 0x00,
+	0x0f, 0x01, 0x00, 0x02, 0x03, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x04,
+	0x02, 0x10, 0x0f, 0x01, 0x00, 0x03, 0x06, 0x01, 0x00, 0x0e, 0x01, 0x00,
+	0x10, 0x01, 0x00, 0x03, 0x07, 0x01, 0x00, 0x0e, 0x01, 0x00, 0x11, 0x01,
+	0x00, 0x03, 0x08, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x12, 0x01, 0x00, 0x03,
+	0x09, 0x02, 0x10, 0x0d, 0x01, 0x00, 0x13, 0x01, 0x00, 0x02, 0x0b, 0x02,
+	0x10, 0x0e, 0x07, 0x60, 0x01, 0x0c, 0x01, 0x00, 0x01, 0x0d, 0x01, 0x00,
+	0x01, 0x0e, 0x01, 0x00, 0x14, 0x0f, 0x0a, 0x06, 0x01, 0xff, 0xff, 0x02,
+	0x00, 0x01, 0x00, 0x02, 0x03, 0x20, 0x02, 0x01, 0x01, 0x00, 0x05, 0x04,
+	0x30, 0x02, 0x02, 0x01, 0x00, 0x09, 0x03, 0x20, 0x02, 0x03, 0x01, 0x00,
+	0x0c, 0x04, 0x30, 0x02, 0x04, 0x01, 0x00, 0x10, 0x04, 0x30, 0x02, 0x04,
+	0x01, 0x00, 0x0f, 0x01, 0x00, 0x02, 0x05, 0x01, 0x00, 0x0e, 0x01, 0x00,
+	0x02, 0x06, 0x01, 0x00, 0x0e, 0x02, 0x10, 0x03, 0x07, 0x01, 0x00, 0x0d,
+	0x01, 0x00, 0x10, 0x01, 0x00, 0x03, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00,
+	0x10, 0x01, 0x00, 0x03, 0x08, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x11, 0x01,
+	0x00, 0x03, 0x09, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x0d, 0x07, 0x60, 0x01,
+	0x0a, 0x01, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x13,
+	0x11, 0x09, 0x08, 0x01, 0xff, 0xff, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01,
+	0x00, 0x02, 0x01, 0x01, 0x00, 0x03, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00,
+	0x05, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x07, 0x02, 0x10, 0x02, 0x03,
+	0x01, 0x00, 0x09, 0x02, 0x10, 0x02, 0x03, 0x01, 0x00, 0x0b, 0x02, 0x10,
+	0x02, 0x04, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x02, 0x04, 0x01, 0x00, 0x0f,
+	0x02, 0x10, 0x02, 0x05, 0x01, 0x00, 0x10, 0x02, 0x10, 0x03, 0x05, 0x01,
+	0x00, 0x0e, 0x02, 0x10, 0x12, 0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0e,
+	0x01, 0x00, 0x02, 0x06, 0x01, 0x00, 0x0d, 0x02, 0x10, 0x03, 0x07, 0x01,
+	0x00, 0x0c, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x07, 0x01, 0x00, 0x0b,
+	0x03, 0x20, 0x0f, 0x01, 0x00, 0x03, 0x08, 0x01, 0x00, 0x0a, 0x01, 0x00,
+	0x0e, 0x03, 0x20, 0x01, 0x08, 0x01, 0x00, 0x01, 0x09, 0x01, 0x00, 0x10,
+	0x13, 0x06, 0x09, 0x01, 0xff, 0xff, 0x01, 0x00, 0x02, 0x10, 0x02, 0x00,
+	0x01, 0x00, 0x02, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00,
+	0x02, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x05,
+	0x02, 0x10, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02,
+	0x02, 0x01, 0x00, 0x0a, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00, 0x0c, 0x01,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x0b, 0x03, 0x20, 0x03, 0x03, 0x01, 0x00,
+	0x09, 0x03, 0x20, 0x0e, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x0f, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x06,
+	0x02, 0x10, 0x0b, 0x01, 0x00, 0x04, 0x03, 0x01, 0x00, 0x05, 0x01, 0x00,
+	0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x03, 0x04, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x0b, 0x01, 0x00, 0x02, 0x04, 0x01, 0x00, 0x09, 0x03, 0x20, 0x02,
+	0x04, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x0c, 0x01, 0x00, 0x0d, 0x15,
+	0x04, 0x0a, 0x01, 0xff, 0xff, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x02, 0x10, 0x02, 0x00, 0x01, 0x00, 0x02, 0x01, 0x00,
+	0x02, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04,
+	0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x00, 0x01,
+	0x00, 0x05, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02,
+	0x00, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x02, 0x00, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00,
+	0x08, 0x03, 0x20, 0x03, 0x00, 0x01, 0x00, 0x06, 0x03, 0x20, 0x0a, 0x01,
+	0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x02, 0x10, 0x08, 0x01, 0x00, 0x0b,
+	0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x02, 0x02, 0x10, 0x08, 0x01, 0x00,
+	0x0c, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x04, 0x01, 0x00, 0x08, 0x01,
+	0x00, 0x03, 0x00, 0x01, 0x00, 0x05, 0x01, 0x00, 0x08, 0x01, 0x00, 0x03,
+	0x00, 0x01, 0x00, 0x06, 0x01, 0x00, 0x08, 0x01, 0x00, 0x01, 0x07, 0x02,
+	0x10, 0x01, 0x08, 0x01, 0x00, 0x0d, 0x15, 0x05, 0x0a, 0x01, 0xff, 0xff,
+	0x01, 0x03, 0x01, 0x00, 0x01, 0x02, 0x02, 0x10, 0x02, 0x02, 0x01, 0x00,
+	0x04, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x04, 0x01, 0x00, 0x02, 0x02,
+	0x01, 0x00, 0x05, 0x01, 0x00, 0x02, 0x02, 0x01, 0x00, 0x05, 0x01, 0x00,
+	0x02, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x06,
+	0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x07, 0x01, 0x00, 0x02, 0x01, 0x01,
+	0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x08, 0x01, 0x00, 0x02,
+	0x01, 0x01, 0x00, 0x09, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x09, 0x02,
+	0x10, 0x02, 0x00, 0x01, 0x00, 0x06, 0x05, 0x40, 0x04, 0x00, 0x01, 0x00,
+	0x02, 0x04, 0x30, 0x08, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x03, 0x00, 0x01,
+	0x00, 0x07, 0x01, 0x00, 0x0b, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x03,
+	0x01, 0x00, 0x07, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00,
+	0x04, 0x01, 0x00, 0x07, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0x05, 0x01,
+	0x00, 0x07, 0x01, 0x00, 0x01, 0x06, 0x02, 0x10, 0x01, 0x07, 0x01, 0x00,
+};
+
+const uint16_t ship_sprites_frames[SHIP_SPRITES_FRAMES] PROGMEM = {
+	0, 128, 260, 389, 518, 636, 740, 817,
+	900, 983, 1062, 1146, 1246, 1360, 1481, 1609,
+	1737, 1862, 1991, 2120, 2244, 2355, 2456, 2541,
+	2620, 2703, 2786, 2870, 2976, 3096, 3223, 3354,
+	3485, 3643, 3806, 3966, 4122, 4258, 4378, 4472,
+	4564, 4659, 4751, 4847, 4965, 5106, 5258, 5412,
+	5569, 5727, 5884, 6038, 6187, 6320, 6432, 6525,
+	6619, 6710, 6808, 6904, 7019, 7151, 7306, 7469,
+};
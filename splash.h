@@ -0,0 +1,268 @@
+/* 320x240 RLE image from tools/splash.ppm, by tools/rle565: 3139 bytes, 2108 runs. */
+
+#include <avr/pgmspace.h>
+
+const uint8_t splash[] PROGMEM = {
+	0x40, 0x01, 0xf0, 0x00, 0x04, 0x00, 0x00, 0x10, 0x84, 0xff, 0xff, 0xe0,
+	0xff, 0xf0, 0xbc, 0x01, 0x01, 0xf0, 0x4f, 0x04, 0x01, 0xf0, 0xe9, 0x00,
+	0x01, 0xf0, 0x39, 0x02, 0x01, 0xf0, 0x2d, 0x00, 0x01, 0xf0, 0x7b, 0x02,
+	0x01, 0xf0, 0x46, 0x02, 0x01, 0xf0, 0x9b, 0x02, 0x02, 0xf0, 0x97, 0x02,
+	0x02, 0xf0, 0xf7, 0x00, 0x01, 0xe0, 0x01, 0xf0, 0xb3, 0x02, 0x01, 0xf0,
+	0xbf, 0x00, 0x01, 0xf0, 0x88, 0x00, 0x02, 0xf0, 0xbd, 0x00, 0xf2, 0x29,
+	0x00, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x17, 0x01,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xda, 0x00, 0x02, 0xf0, 0x3c, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x55, 0x00, 0xf2, 0x10, 0x00, 0x40, 0x02, 0xf0, 0xac, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0xb2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0xb2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00,
+	0x02, 0xd0, 0x02, 0xf0, 0xb2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0x60, 0x00, 0xf2, 0x1f, 0x00, 0xf0,
+	0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0x60, 0x00,
+	0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0,
+	0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00,
+	0x02, 0xd0, 0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x1b, 0x00, 0x01, 0xf0, 0x39, 0x00,
+	0x02, 0xd0, 0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0x60, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x26, 0x00, 0x01, 0xb0,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x55, 0x00, 0xe2, 0xf0, 0x61, 0x00,
+	0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0x60, 0x02, 0xf0,
+	0xb9, 0x00, 0x01, 0x20, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00,
+	0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x7d, 0x00, 0x02, 0xf0, 0x47, 0x00, 0x02, 0x50, 0x01, 0xf0,
+	0x16, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0,
+	0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0,
+	0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00, 0x02, 0xf0,
+	0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0xc5, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xc0, 0x01, 0xf0, 0xb7, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xc5, 0x00,
+	0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x33, 0x00, 0x01, 0xf0, 0x91, 0x00, 0xf2, 0x1e, 0x00, 0xf0,
+	0x34, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x17, 0x01, 0xf2, 0x28,
+	0x00, 0xf0, 0x74, 0x15, 0x01, 0xf0, 0xa9, 0x00, 0x02, 0xf0, 0x3a, 0x00,
+	0xe3, 0xf0, 0x2d, 0x00, 0x23, 0xf0, 0x30, 0x00, 0x83, 0xf0, 0x1e, 0x00,
+	0x23, 0xf0, 0x45, 0x00, 0x23, 0xf0, 0x15, 0x00, 0x23, 0xf0, 0x47, 0x00,
+	0xe3, 0xf0, 0x2d, 0x00, 0x23, 0xf0, 0x30, 0x00, 0x83, 0xf0, 0x1e, 0x00,
+	0x23, 0xf0, 0x45, 0x00, 0x23, 0xf0, 0x15, 0x00, 0x23, 0xf0, 0x47, 0x00,
+	0xe3, 0xf0, 0x2d, 0x00, 0x23, 0xf0, 0x30, 0x00, 0x83, 0xf0, 0x1e, 0x00,
+	0x23, 0xf0, 0x45, 0x00, 0x23, 0xf0, 0x15, 0x00, 0x23, 0xf0, 0x47, 0x00,
+	0x23, 0xf0, 0x39, 0x00, 0x23, 0xf0, 0x2d, 0x00, 0x23, 0x80, 0x23, 0xf0,
+	0x1b, 0x00, 0x23, 0xf0, 0x5d, 0x00, 0x23, 0xf0, 0x47, 0x00, 0x23, 0xf0,
+	0x39, 0x00, 0x23, 0xf0, 0x2d, 0x00, 0x23, 0x80, 0x23, 0xf0, 0x1b, 0x00,
+	0x23, 0xf0, 0x5d, 0x00, 0x23, 0xf0, 0x47, 0x00, 0x23, 0xf0, 0x39, 0x00,
+	0x23, 0xf0, 0x2d, 0x00, 0x23, 0x80, 0x23, 0xf0, 0x1b, 0x00, 0x23, 0xf0,
+	0x5d, 0x00, 0x23, 0xf0, 0x47, 0x00, 0x23, 0xf0, 0x12, 0x00, 0x83, 0x80,
+	0x23, 0x20, 0x53, 0x20, 0xe3, 0x20, 0x23, 0x80, 0x23, 0x20, 0x23, 0x20,
+	0x53, 0x50, 0x23, 0x80, 0x23, 0x50, 0x83, 0x50, 0xe3, 0x50, 0x83, 0x80,
+	0x23, 0x20, 0x53, 0x50, 0x83, 0x80, 0x53, 0xb0, 0xb3, 0x50, 0x83, 0xf0,
+	0x38, 0x00, 0x23, 0xf0, 0x12, 0x00, 0x83, 0x80, 0x23, 0x20, 0x53, 0x20,
+	0xe3, 0x20, 0x23, 0x80, 0x23, 0x20, 0x23, 0x20, 0x53, 0x50, 0x23, 0x80,
+	0x23, 0x50, 0x83, 0x50, 0xe3, 0x50, 0x83, 0x80, 0x23, 0x20, 0x53, 0x50,
+	0x83, 0x80, 0x53, 0xb0, 0xb3, 0x50, 0x83, 0xf0, 0x38, 0x00, 0x23, 0xf0,
+	0x12, 0x00, 0x83, 0x80, 0x23, 0x20, 0x53, 0x20, 0xe3, 0x20, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x20, 0x53, 0x50, 0x23, 0x80, 0x23, 0x50, 0x83, 0x50,
+	0xe3, 0x50, 0x83, 0x80, 0x23, 0x20, 0x53, 0x50, 0x83, 0x80, 0x53, 0xb0,
+	0xb3, 0x50, 0x83, 0xf0, 0x38, 0x00, 0xb3, 0x50, 0x23, 0x80, 0x23, 0x50,
+	0x53, 0xe0, 0x23, 0x80, 0x23, 0x80, 0x23, 0x20, 0x53, 0x50, 0x23, 0x20,
+	0xe3, 0x20, 0x23, 0xf0, 0x15, 0x00, 0x23, 0x80, 0x23, 0x80, 0x23, 0x50,
+	0x53, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x20,
+	0x23, 0xf0, 0x41, 0x00, 0xb3, 0x50, 0x23, 0x80, 0x23, 0x50, 0x53, 0xe0,
+	0x23, 0x80, 0x23, 0x80, 0x23, 0x20, 0x53, 0x50, 0x23, 0x20, 0xe3, 0x20,
+	0x23, 0xf0, 0x15, 0x00, 0x23, 0x80, 0x23, 0x80, 0x23, 0x50, 0x53, 0x80,
+	0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x20, 0x23, 0xf0,
+	0x41, 0x00, 0xb3, 0x50, 0x23, 0x80, 0x23, 0x50, 0x53, 0xe0, 0x23, 0x80,
+	0x23, 0x80, 0x23, 0x20, 0x53, 0x50, 0x23, 0x20, 0xe3, 0x20, 0x23, 0xf0,
+	0x15, 0x00, 0x23, 0x80, 0x23, 0x80, 0x23, 0x50, 0x53, 0x80, 0x23, 0x80,
+	0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x20, 0x23, 0xf0, 0x41, 0x00,
+	0x23, 0xe0, 0x23, 0x80, 0x23, 0x50, 0x23, 0xf0, 0x12, 0x00, 0x23, 0x80,
+	0x23, 0x80, 0x23, 0x20, 0x23, 0x80, 0x23, 0x20, 0x23, 0x80, 0x23, 0x50,
+	0x83, 0xb0, 0x23, 0x80, 0xe3, 0x50, 0x23, 0xb0, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0x80, 0x23, 0x80, 0x23, 0x50, 0x83, 0xf0, 0x38, 0x00, 0x23, 0xe0,
+	0x23, 0x80, 0x23, 0x50, 0x23, 0xf0, 0x12, 0x00, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x80, 0x23, 0x20, 0x23, 0x80, 0x23, 0x50, 0x83, 0xb0,
+	0x23, 0x80, 0xe3, 0x50, 0x23, 0xb0, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0x80, 0x23, 0x50, 0x83, 0xf0, 0x38, 0x00, 0x23, 0xe0, 0x23, 0x80,
+	0x23, 0x50, 0x23, 0xf0, 0x12, 0x00, 0x23, 0x80, 0x23, 0x80, 0x23, 0x20,
+	0x23, 0x80, 0x23, 0x20, 0x23, 0x80, 0x23, 0x50, 0x83, 0xb0, 0x23, 0x80,
+	0xe3, 0x50, 0x23, 0xb0, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0x50, 0x83, 0xf0, 0x38, 0x00, 0x23, 0xe0, 0x23, 0x80, 0x23, 0x50,
+	0x23, 0xf0, 0x12, 0x00, 0x23, 0x80, 0x23, 0x50, 0x53, 0x20, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x80, 0x23, 0xe0, 0x23, 0x80, 0x23, 0x80, 0x23, 0xf0,
+	0x12, 0x00, 0x23, 0xb0, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0xe0, 0x23, 0xf0, 0x35, 0x00, 0x23, 0xe0, 0x23, 0x80, 0x23, 0x50,
+	0x23, 0xf0, 0x12, 0x00, 0x23, 0x80, 0x23, 0x50, 0x53, 0x20, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x80, 0x23, 0xe0, 0x23, 0x80, 0x23, 0x80, 0x23, 0xf0,
+	0x12, 0x00, 0x23, 0xb0, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0xe0, 0x23, 0xf0, 0x35, 0x00, 0x23, 0xe0, 0x23, 0x80, 0x23, 0x50,
+	0x23, 0xf0, 0x12, 0x00, 0x23, 0x80, 0x23, 0x50, 0x53, 0x20, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x80, 0x23, 0xe0, 0x23, 0x80, 0x23, 0x80, 0x23, 0xf0,
+	0x12, 0x00, 0x23, 0xb0, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80, 0x23, 0x80,
+	0x23, 0xe0, 0x23, 0xf0, 0x35, 0x00, 0x23, 0xf0, 0x12, 0x00, 0x83, 0x80,
+	0x23, 0xf0, 0x15, 0x00, 0x53, 0x50, 0x53, 0x20, 0x23, 0x20, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x80, 0x23, 0x20, 0xb3, 0xe0, 0x53, 0x50, 0x83, 0x80,
+	0x23, 0xe0, 0x83, 0x80, 0x83, 0x80, 0xb3, 0x20, 0xb3, 0xf0, 0x38, 0x00,
+	0x23, 0xf0, 0x12, 0x00, 0x83, 0x80, 0x23, 0xf0, 0x15, 0x00, 0x53, 0x50,
+	0x53, 0x20, 0x23, 0x20, 0x23, 0x80, 0x23, 0x20, 0x23, 0x80, 0x23, 0x20,
+	0xb3, 0xe0, 0x53, 0x50, 0x83, 0x80, 0x23, 0xe0, 0x83, 0x80, 0x83, 0x80,
+	0xb3, 0x20, 0xb3, 0xf0, 0x38, 0x00, 0x23, 0xf0, 0x12, 0x00, 0x83, 0x80,
+	0x23, 0xf0, 0x15, 0x00, 0x53, 0x50, 0x53, 0x20, 0x23, 0x20, 0x23, 0x80,
+	0x23, 0x20, 0x23, 0x80, 0x23, 0x20, 0xb3, 0xe0, 0x53, 0x50, 0x83, 0x80,
+	0x23, 0xe0, 0x83, 0x80, 0x83, 0x80, 0xb3, 0x20, 0xb3, 0xf0, 0x9d, 0x06,
+	0x01, 0xf0, 0xaf, 0x08, 0x01, 0xf0, 0x6d, 0x00, 0x02, 0xf0, 0xba, 0x01,
+	0x01, 0xf0, 0x8c, 0x03, 0x02, 0xf0, 0x97, 0x04, 0x01, 0xf0, 0x79, 0x09,
+	0x02, 0xf0, 0x28, 0x03, 0x12, 0xf0, 0x3e, 0x01, 0x12, 0xf0, 0x3d, 0x01,
+	0x02, 0x10, 0x02, 0xf0, 0x33, 0x00, 0x02, 0xf0, 0x08, 0x01, 0x02, 0x10,
+	0x02, 0xf0, 0x3c, 0x01, 0x02, 0x10, 0x02, 0xf0, 0x16, 0x00, 0x01, 0xf0,
+	0x24, 0x01, 0x02, 0x30, 0x02, 0xf0, 0x3a, 0x01, 0x02, 0x30, 0x02, 0xf0,
+	0xcd, 0x00, 0x01, 0xf0, 0x6b, 0x00, 0x02, 0x50, 0x02, 0xf0, 0x38, 0x01,
+	0x02, 0x50, 0x02, 0xf0, 0x38, 0x01, 0x02, 0x50, 0x02, 0xf0, 0x37, 0x01,
+	0x02, 0x70, 0x02, 0xf0, 0x36, 0x01, 0x02, 0x70, 0x02, 0xf0, 0x55, 0x00,
+	0xf2, 0x29, 0x00, 0xf0, 0xb7, 0x00, 0x02, 0x90, 0x02, 0xf0, 0x54, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xb7, 0x00, 0x02, 0x90, 0x02, 0xf0,
+	0x54, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xb7, 0x00, 0x02, 0x90,
+	0x02, 0xf0, 0x54, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xb6, 0x00,
+	0x02, 0x00, 0xb2, 0xf0, 0x53, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x92, 0x00, 0x02, 0xf0, 0x23, 0x00, 0x02, 0xb0, 0x02, 0xf0, 0x53, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xb5, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0x52, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xb5, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0x52, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0xb5, 0x00,
+	0x02, 0xd0, 0x02, 0xf0, 0x52, 0x00, 0x02, 0xf0, 0x24, 0x00, 0x01, 0x10,
+	0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00,
+	0xf2, 0x10, 0x00, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x41, 0x00, 0x01, 0x20, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00,
+	0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00,
+	0x02, 0x60, 0x01, 0x50, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00,
+	0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x45, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0x1f, 0x00, 0x01, 0xf0, 0xa2, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x23, 0x00, 0x02, 0xf0, 0x21, 0x00, 0xe2, 0xf0, 0xc3, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x8f, 0x00, 0x01, 0xf0,
+	0x87, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x6d, 0x00, 0x01, 0xf0,
+	0xa9, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0,
+	0x1f, 0x00, 0x01, 0x60, 0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00,
+	0x02, 0xf0, 0x17, 0x01, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x7d, 0x00,
+	0xf2, 0x1f, 0x00, 0xf0, 0x7b, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x7d, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x7b, 0x00, 0x02, 0xf0,
+	0x27, 0x00, 0x02, 0xf0, 0x7d, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x7b, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0, 0x7d, 0x00, 0x02, 0xf0,
+	0x1d, 0x00, 0x02, 0xf0, 0x7b, 0x00, 0x02, 0xf0, 0x27, 0x00, 0x02, 0xf0,
+	0x7d, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x7b, 0x00, 0xf2, 0x28,
+	0x00, 0xf0, 0x4c, 0x00, 0x02, 0xf0, 0x31, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x3d, 0x00, 0x01, 0xf0, 0xe3, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0xc6, 0x00, 0x02, 0xf0, 0x5a, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x21, 0x01, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x26, 0x00,
+	0x02, 0xf0, 0xfa, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0xa7, 0x00,
+	0x02, 0xf0, 0x79, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00,
+	0xf2, 0x10, 0x00, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00,
+	0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0,
+	0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00,
+	0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0,
+	0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0,
+	0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00,
+	0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0,
+	0x4f, 0x00, 0x02, 0xd0, 0x02, 0x01, 0xf0, 0xc1, 0x00, 0x02, 0xf0, 0x1d,
+	0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0x8f, 0x00, 0x01,
+	0xf0, 0x32, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02,
+	0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f,
+	0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02,
+	0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d,
+	0x00, 0x02, 0xf0, 0x30, 0x00, 0x01, 0xf0, 0x1e, 0x00, 0x02, 0xd0, 0x02,
+	0xf0, 0x56, 0x00, 0x01, 0xf0, 0x4f, 0x00, 0x02, 0xf0, 0x1b, 0x00, 0x02,
+	0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02, 0xf0, 0xc2,
+	0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0x02, 0xd0, 0x02,
+	0xf0, 0xc2, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x4f, 0x00, 0xe2,
+	0xf0, 0xc3, 0x00, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x21, 0x01, 0x02,
+	0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x21, 0x01, 0x02, 0xf0, 0x1d, 0x00, 0x02,
+	0xf0, 0x21, 0x01, 0x02, 0xf0, 0x1d, 0x00, 0x02, 0xf0, 0x02, 0x01, 0x01,
+	0xf0, 0x1e, 0x00, 0xf2, 0x1e, 0x00, 0xf0, 0xe8, 0x05, 0x01, 0xf0, 0x42,
+	0x01, 0x21, 0x10, 0x41, 0x00, 0x01, 0x20, 0x01, 0x00, 0x41, 0x00, 0x41,
+	0x00, 0x31, 0xf0, 0x15, 0x00, 0x11, 0xf0, 0x21, 0x00, 0x01, 0x20, 0x01,
+	0x00, 0x31, 0xf0, 0x21, 0x00, 0x11, 0xf0, 0x21, 0x00, 0x31, 0x20, 0x21,
+	0x10, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0xf0, 0x15, 0x00, 0x01,
+	0xf0, 0x6b, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x40, 0x11, 0x10, 0x01,
+	0x20, 0x01, 0x20, 0x01, 0x40, 0x01, 0x20, 0x01, 0x10, 0x11, 0xf0, 0x11,
+	0x00, 0x01, 0xf0, 0x21, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01,
+	0x10, 0x11, 0xf0, 0x1d, 0x00, 0x01, 0xf0, 0x21, 0x00, 0x01, 0x20, 0x01,
+	0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x11, 0x10, 0x01,
+	0x10, 0x11, 0xf0, 0x11, 0x00, 0x01, 0xf0, 0x6b, 0x00, 0x01, 0x40, 0x01,
+	0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x20, 0x01, 0x20, 0x01, 0x40, 0x01,
+	0x20, 0x01, 0x10, 0x11, 0x80, 0x31, 0x30, 0x01, 0x30, 0x21, 0x10, 0x01,
+	0x20, 0x01, 0xf0, 0x13, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01,
+	0x10, 0x11, 0x90, 0x01, 0x00, 0x11, 0x10, 0x21, 0x10, 0x31, 0x30, 0x01,
+	0x30, 0x21, 0x10, 0x01, 0x20, 0x01, 0xf0, 0x13, 0x00, 0x01, 0x20, 0x01,
+	0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x10, 0x11, 0x90, 0x21, 0x10, 0x41, 0x10, 0x01, 0x00, 0x11,
+	0x10, 0x21, 0x20, 0x21, 0x20, 0x21, 0xf0, 0x52, 0x00, 0x01, 0x40, 0x31,
+	0x10, 0x01, 0x10, 0x11, 0x20, 0x01, 0x20, 0x31, 0x10, 0x31, 0xd0, 0x01,
+	0x20, 0x01, 0x20, 0x01, 0x60, 0x01, 0x00, 0x01, 0x20, 0x01, 0xf0, 0x13,
+	0x00, 0x01, 0x20, 0x01, 0x00, 0x31, 0xe0, 0x11, 0x20, 0x01, 0x20, 0x01,
+	0x00, 0x01, 0x20, 0x01, 0x20, 0x01, 0x60, 0x01, 0x00, 0x01, 0x20, 0x01,
+	0xf0, 0x13, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01,
+	0x20, 0x01, 0x00, 0x01, 0x10, 0x11, 0xc0, 0x01, 0x60, 0x01, 0x30, 0x11,
+	0x20, 0x01, 0x20, 0x01, 0x00, 0x01, 0x40, 0x01, 0xf0, 0x55, 0x00, 0x01,
+	0x40, 0x01, 0x40, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01, 0x40, 0x01,
+	0x20, 0x01, 0x10, 0x11, 0x80, 0x31, 0x30, 0x01, 0x30, 0x31, 0x10, 0x31,
+	0xf0, 0x13, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x50, 0x11, 0x90, 0x01,
+	0x30, 0x41, 0x00, 0x31, 0x30, 0x01, 0x30, 0x31, 0x10, 0x31, 0xf0, 0x13,
+	0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x20, 0x01, 0x10, 0x11, 0x90, 0x21, 0x30, 0x01,
+	0x30, 0x01, 0x30, 0x41, 0x10, 0x21, 0x20, 0x21, 0xf0, 0x52, 0x00, 0x01,
+	0x20, 0x01, 0x00, 0x01, 0x40, 0x01, 0x20, 0x01, 0x20, 0x01, 0x20, 0x01,
+	0x40, 0x01, 0x20, 0x01, 0x10, 0x11, 0x80, 0x01, 0x60, 0x01, 0x20, 0x01,
+	0x20, 0x01, 0x40, 0x01, 0xf0, 0x13, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01,
+	0x50, 0x11, 0x90, 0x01, 0x30, 0x01, 0x40, 0x01, 0x60, 0x01, 0x20, 0x01,
+	0x20, 0x01, 0x40, 0x01, 0xf0, 0x13, 0x00, 0x01, 0x20, 0x01, 0x00, 0x01,
+	0x20, 0x01, 0x00, 0x11, 0x00, 0x11, 0x00, 0x01, 0x20, 0x01, 0x10, 0x11,
+	0xc0, 0x01, 0x20, 0x01, 0x30, 0x01, 0x30, 0x01, 0x80, 0x01, 0x40, 0x01,
+	0xf0, 0x52, 0x00, 0x21, 0x10, 0x41, 0x00, 0x01, 0x20, 0x01, 0x20, 0x01,
+	0x20, 0x41, 0x00, 0x01, 0x20, 0x01, 0xc0, 0x01, 0x50, 0x21, 0x20, 0x31,
+	0x10, 0x21, 0xf0, 0x15, 0x00, 0x21, 0x10, 0x01, 0xf0, 0x12, 0x00, 0x01,
+	0x40, 0x21, 0x10, 0x01, 0x50, 0x21, 0x20, 0x31, 0x10, 0x21, 0xf0, 0x14,
+	0x00, 0x31, 0x20, 0x21, 0x10, 0x01, 0x20, 0x01, 0x00, 0x01, 0x20, 0x01,
+	0xc0, 0x31, 0x40, 0x11, 0x10, 0x01, 0x40, 0x21, 0x10, 0x31, 0x10, 0x31,
+	0xf0, 0xf2, 0x04, 0x01, 0xf0, 0x3c, 0x08, 0x02, 0xf0, 0x8c, 0x00, 0x01,
+	0xf0, 0x1c, 0x00, 0x01, 0xf0, 0x11, 0x01, 0x02, 0xf0, 0x36, 0x0a, 0x01,
+	0xf0, 0x7b, 0x00, 0x01, 0xf0, 0xcb, 0x00,
+};
@@ -0,0 +1,77 @@
+#include "stack.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "lcd.h"
+
+extern uint8_t _end;    // End of .bss; no heap is used.
+extern uint8_t __stack; // RAMEND
+
+void stack_paint(void) __attribute__ ((naked, used, section (".init1")));
+
+/*
+ * Runs before .data/.bss are set up and before r1 is cleared, so it is
+ * written in assembly.
+ */
+void stack_paint(void) {
+	asm volatile (
+		"    ldi r30, lo8(_end)       \n"
+		"    ldi r31, hi8(_end)       \n"
+		"    ldi r24, %0              \n"
+		"    ldi r25, hi8(__stack)    \n"
+		"    rjmp 2f                  \n"
+		"1:  st Z+, r24               \n"
+		"2:  cpi r30, lo8(__stack)    \n"
+		"    cpc r31, r25             \n"
+		"    brlo 1b                  \n"
+		"    breq 1b                  \n"
+		:: "i" (STACK_CANARY));
+}
+
+/*
+ * Bytes between the end of static data and the top of RAM.
+ */
+uint16_t stack_size() {
+	return &__stack - &_end + 1;
+}
+
+/*
+ * Bytes the stack has never reached since reset.
+ */
+uint16_t stack_free() {
+	const uint8_t *p = &_end;
+	while (p <= &__stack && *p == STACK_CANARY)
+		p++;
+	return p - &_end;
+}
+
+/*
+ * Deepest the stack has been since reset, in bytes.
+ */
+uint16_t stack_high_water() {
+	return stack_size() - stack_free();
+}
+
+/*
+ * Halts with a diagnostic screen once the stack has come within STACK_GUARD
+ * bytes of the static data. Only looks at the guard band, so it is cheap
+ * enough to call every tick.
+ */
+void stack_check() {
+	const uint8_t *p = &_end + STACK_GUARD;
+	while (p > &_end)
+		if (*--p != STACK_CANARY)
+			goto overflow;
+	return;
+	
+overflow:
+	cli();
+	display_color(WHITE, RED);
+	clear_screen();
+	display_string_xy("STACK OVERFLOW", 10, 10);
+	display_thing_xy(10, 30, "Static RAM: %d", (uint16_t) &_end - RAMSTART);
+	display_thing_xy(10, 40, "Stack size: %d", stack_size());
+	display_thing_xy(10, 50, "High water: %d", stack_high_water());
+	display_thing_xy(10, 60, "Guard:      %d", STACK_GUARD);
+	for (;;)
+		;
+}
@@ -0,0 +1,17 @@
+/*
+ * Stack painting and high-water mark. The free RAM between the end of the
+ * static data and the stack is filled with STACK_CANARY at reset; bytes the
+ * stack has ever reached no longer hold it.
+ */
+
+#include <stdint.h>
+
+#define STACK_CANARY 0xC5
+#ifndef STACK_GUARD
+#define STACK_GUARD 32 // Untouched bytes below which stack_check() halts.
+#endif
+
+uint16_t stack_size();
+uint16_t stack_free();
+uint16_t stack_high_water();
+void stack_check();
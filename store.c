@@ -0,0 +1,112 @@
+#include "store.h"
+#include "eewrite.h"
+#include "power.h"
+#include <stddef.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+store_record store;
+uint8_t store_slot = STORE_SLOTS - 1; // Where the cached record came from.
+uint8_t store_pending = 0;
+
+static uint16_t store_crc(const store_record *r) {
+	const uint8_t *p = (const uint8_t *) r;
+	uint16_t crc = 0;
+	uint8_t i;
+	for (i = 0; i < offsetof(store_record, crc); i++)
+		crc = _crc_xmodem_update(crc, p[i]);
+	return crc;
+}
+
+static uint16_t slot_addr(uint8_t slot) {
+	return STORE_ADDR + slot * sizeof(store_record);
+}
+
+/*
+ * Finds the newest good record, or starts from the defaults with no
+ * scores if there is none. Sequence numbers are compared as differences,
+ * so they can wrap.
+ */
+void init_store() {
+	store_record r;
+	uint8_t slot, found = 0;
+
+	for (slot = 0; slot < STORE_SLOTS; slot++) {
+		eeprom_read_block(&r, (const void *) slot_addr(slot), sizeof(r));
+		if (r.version != STORE_VERSION || r.crc != store_crc(&r))
+			continue;
+		if (!found || (int16_t) (r.seq - store.seq) > 0) {
+			store = r;
+			store_slot = slot;
+			found = 1;
+		}
+	}
+	if (!found) {
+		uint8_t i;
+		store.version = STORE_VERSION;
+		store.seq = 0;
+		store.brightness = BRIGHTNESS_ACTIVE;
+		store.frame_rate = FRAME_RATE_ACTIVE;
+		for (i = 0; i < NO_HIGH_SCORES; i++)
+			store.scores[i] = 0;
+		for (i = 0; i < sizeof(store.reserved); i++)
+			store.reserved[i] = 0;
+	}
+}
+
+/*
+ * Writes the cached record to the next slot, or leaves it for
+ * store_poll() if the queue has no room for it yet.
+ */
+static void store_save() {
+	const uint8_t *p = (const uint8_t *) &store;
+	uint16_t addr;
+	uint8_t i;
+
+	if (ee_room() < sizeof(store)) {
+		store_pending = 1;
+		return;
+	}
+	store_pending = 0;
+	if (++store_slot == STORE_SLOTS)
+		store_slot = 0;
+	store.seq++;
+	store.crc = store_crc(&store);
+	addr = slot_addr(store_slot);
+	for (i = 0; i < sizeof(store); i++)
+		ee_write(addr + i, p[i]);
+}
+
+/*
+ * Called every tick: finishes a save that found the queue full.
+ */
+void store_poll() {
+	if (store_pending)
+		store_save();
+}
+
+/*
+ * Enters a finished game's score in the table. Returns its place, 1 for
+ * the best, or 0 if it did not make the table.
+ */
+uint8_t store_score(uint16_t score) {
+	uint8_t i, j;
+	for (i = 0; i < NO_HIGH_SCORES; i++)
+		if (score > store.scores[i])
+			break;
+	if (i == NO_HIGH_SCORES)
+		return 0;
+	for (j = NO_HIGH_SCORES - 1; j > i; j--)
+		store.scores[j] = store.scores[j - 1];
+	store.scores[i] = score;
+	store_save();
+	return i + 1;
+}
+
+void store_settings(uint8_t brightness, uint8_t frame_rate) {
+	if (brightness == store.brightness && frame_rate == store.frame_rate)
+		return;
+	store.brightness = brightness;
+	store.frame_rate = frame_rate;
+	store_save();
+}
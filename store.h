@@ -0,0 +1,32 @@
+/*
+ * High scores and settings, kept in EEPROM above the replay area as a
+ * ring of versioned, checksummed records. Each save goes to the next slot
+ * round, so the wear is spread over all of them, and a save cut short by a
+ * power cycle fails its check and the one before it is used. The newest
+ * good record is read once at boot; after that everything is served from
+ * the copy in RAM and saves go out through eewrite.c.
+ */
+
+#include <stdint.h>
+
+#define STORE_ADDR 0xE00 // After the replay area (replay.h).
+#define STORE_SLOTS 16
+#define STORE_VERSION 1
+#define NO_HIGH_SCORES 10
+
+typedef struct {
+	uint8_t version;
+	uint16_t seq;     // One more than the record it replaced.
+	uint8_t brightness;
+	uint8_t frame_rate;
+	uint16_t scores[NO_HIGH_SCORES]; // Best first.
+	uint8_t reserved[5];
+	uint16_t crc;     // CRC-16 (XMODEM) of everything above.
+} __attribute__((packed)) store_record;
+
+extern store_record store;
+
+void init_store();
+void store_poll();
+uint8_t store_score(uint16_t score);
+void store_settings(uint8_t brightness, uint8_t frame_rate);
@@ -1,120 +1,223 @@
 #include "switches.h"
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include "clock.h"
 
 /*
  * Adapted from 'switches.c', from last year. I am unsure as the the original
  * author of it, it is present in a couple of projects (inc. TronFortuna and
  * FortunaTetris) 
+ *
+ * The buttons are sampled every millisecond from TIMER0 and debounced there;
+ * the centre button also has INT7 to timestamp its first edge exactly.
+ * Debounced changes go into a ring of timestamped events which the game
+ * drains once per tick with input_tick(), so no press is lost however short
+ * it is compared to the tick.
  */
 
-int center_down = 0;
-int left_down = 0;
-int right_down = 0;
-int up_down = 0;
-int down_down = 0;
-int down = 0;
+// Filled by the sampling interrupt only.
+volatile input_event events[EVENT_QUEUE];
+volatile uint8_t event_head = 0;
+// Drained by input_tick() only.
+volatile uint8_t event_tail = 0;
 
-void init_switches(){
-	DDRE &= ~_BV(SWC);
-	PORTE |= _BV(SWC);
-	DDRC &= ~_BV(SWN) & ~_BV(SWE) & ~_BV(SWS) & ~_BV(SWW);
-	PORTC |= _BV(SWN) | _BV(SWE) | _BV(SWS) | _BV(SWW);
+uint8_t stable = 0;   // Debounced state, bit per button.
+uint8_t stamped = 0;  // Buttons with a change in progress.
+uint8_t count[NO_BUTTONS];
+uint16_t since[NO_BUTTONS];
+
+// State as of the last input_tick().
+uint8_t held = 0;
+uint8_t pressed = 0;
+uint8_t released = 0;
+uint32_t press_us[NO_BUTTONS];
+
+uint16_t input_latency_max = 0;
+uint16_t input_dropped = 0;
 
+void init_switches(){
 	DDRE &= ~_BV(SWC);   /* Central button */
 	PORTE |= _BV(SWC);
 	
 	DDRC &= ~COMPASS_SWITCHES;  /* configure compass buttons for input */
 	PORTC |= COMPASS_SWITCHES; 
 
-	EICRB |= _BV(ISC40) | _BV(ISC50) | _BV(ISC71);
+	/* Any edge on INT7 (centre) */
+	EICRB = (EICRB & ~_BV(ISC71)) | _BV(ISC70);
+	EIFR = _BV(INTF7);
+	EIMSK |= _BV(INT7);
+	
+	/* 1kHz sampling: CTC, F_CPU / 64 / 125 */
+	TCCR0A = _BV(WGM01);
+	TCCR0B = _BV(CS01) | _BV(CS00);
+	OCR0A = F_CPU / 64 / 1000 - 1;
+	TIMSK0 = _BV(OCIE0A);
 }
 
-int center_pressed(){
-	if ((~PINE & _BV(SWC)) && !center_down && !down) {
-		center_down = 1;
-		down = 1;
-		return 1;
-	} else if ((PINE & _BV(SWC)) && center_down){
-		center_down = 0;
-		down = 0;
+/*
+ * Buttons currently down, before debouncing.
+ */
+static uint8_t read_buttons() {
+	uint8_t c = ~PINC;
+	uint8_t b = 0;
+	if (c & _BV(SWN)) b |= _BV(BTN_UP);
+	if (c & _BV(SWE)) b |= _BV(BTN_RIGHT);
+	if (c & _BV(SWS)) b |= _BV(BTN_DOWN);
+	if (c & _BV(SWW)) b |= _BV(BTN_LEFT);
+	if (~PINE & _BV(SWC)) b |= _BV(BTN_CENTER);
+	return b;
+}
+
+static void push_event(uint16_t time, uint8_t button, uint8_t type) {
+	uint8_t next = (event_head + 1) & (EVENT_QUEUE - 1);
+	if (next == event_tail) {
+		input_dropped++;
+		return;
 	}
-	return 0;
+	events[event_head].time = time;
+	events[event_head].button = button;
+	events[event_head].type = type;
+	event_head = next;
 }
 
-int up_pressed(){
-	if ((~PINC & _BV(SWN)) && !left_down && !down) {
-		left_down = 1;
-		down = 1;
-		return 1;
-	} else if ((PINC & _BV(SWN))&& left_down){
-		left_down = 0;
-		down = 0;
+ISR(INT7_vect) {
+	if (!(stamped & _BV(BTN_CENTER))) {
+		since[BTN_CENTER] = clock_now();
+		stamped |= _BV(BTN_CENTER);
 	}
-	return 0;
 }
 
-int down_pressed(){
-	if ((~PINC & _BV(SWS)) && !right_down && !down) {
-		right_down = 1;
-		down = 1;
-		return 1;
-	} else if ((PINC & _BV(SWS)) && right_down){
-		right_down = 0;
-		down = 0;
+/*
+ * A button changes state once it has read the same for DEBOUNCE_MS samples;
+ * the event carries the time of its first edge, not of the confirmation.
+ */
+ISR(TIMER0_COMPA_vect) {
+	uint8_t changed = read_buttons() ^ stable;
+	uint16_t now = clock_now();
+	uint8_t b;
+	
+	for (b = 0; b < NO_BUTTONS; b++) {
+		uint8_t bit = _BV(b);
+		if (!(changed & bit)) {
+			count[b] = 0;
+			stamped &= ~bit;
+			continue;
+		}
+		if (!(stamped & bit)) {
+			since[b] = now;
+			stamped |= bit;
+		}
+		if (++count[b] >= DEBOUNCE_MS) {
+			stable ^= bit;
+			count[b] = 0;
+			stamped &= ~bit;
+			push_event(since[b], b, (stable & bit)?EV_PRESS:EV_RELEASE);
+		}
 	}
-	return 0;
 }
 
-int right_pressed(){
-	if ((~PINC & _BV(SWE)) && !up_down && !down) {
-		up_down = 1;
-		down = 1;
-		return 1;
-	} else if ((PINC & _BV(SWE)) && up_down){
-		up_down = 0;
-		down = 0;
+/*
+ * Takes the oldest event off the queue. Returns 0 if there is none.
+ */
+uint8_t input_next(input_event *ev) {
+	if (event_tail == event_head)
+		return 0;
+	ev->time = events[event_tail].time;
+	ev->button = events[event_tail].button;
+	ev->type = events[event_tail].type;
+	event_tail = (event_tail + 1) & (EVENT_QUEUE - 1);
+	return 1;
+}
+
+/*
+ * Drains the event queue. Edges reported by switch_pressed() and
+ * switch_released() are those since the previous call. Returns the number
+ * of events consumed.
+ */
+uint8_t input_tick() {
+	input_event ev;
+	uint8_t n = 0;
+	uint32_t now_us = clock_us();
+	uint16_t now = now_us;
+	
+	pressed = 0;
+	released = 0;
+	while (input_next(&ev)) {
+		uint8_t bit = _BV(ev.button);
+		uint16_t latency = now - ev.time;
+		if (ev.type == EV_PRESS) {
+			if (!(pressed & bit))
+				press_us[ev.button] = now_us - latency;
+			pressed |= bit;
+			held |= bit;
+		} else {
+			released |= bit;
+			held &= ~bit;
+		}
+		
+		if (latency > input_latency_max)
+			input_latency_max = latency;
+		n++;
 	}
-	return 0;
+	return n;
+}
+
+/*
+ * True if the button was down at any point during the last tick, so a tap
+ * shorter than the tick still counts as held once.
+ */
+uint8_t switch_held(uint8_t button) {
+	return ((held | pressed) >> button) & 1;
+}
+
+uint8_t switch_pressed(uint8_t button) {
+	return (pressed >> button) & 1;
+}
+
+uint8_t switch_released(uint8_t button) {
+	return (released >> button) & 1;
+}
+
+/*
+ * clock_us() time of the button's first press edge in the last tick; only
+ * meaningful if switch_pressed() is true.
+ */
+uint32_t switch_press_us(uint8_t button) {
+	return press_us[button];
+}
+
+int center_pressed(){
+	return switch_pressed(BTN_CENTER);
+}
+
+int up_pressed(){
+	return switch_pressed(BTN_UP);
+}
+
+int down_pressed(){
+	return switch_pressed(BTN_DOWN);
+}
+
+int right_pressed(){
+	return switch_pressed(BTN_RIGHT);
 }
 
 int left_pressed(){
-	if ((~PINC & _BV(SWW)) && !down_down && !down) {
-		down_down = 1;
-		down = 1;
-		return 1;
-	} else if ((PINC & _BV(SWW)) && down_down){
-		down_down = 0;
-		down = 0;
-	}
-	return 0;
+	return switch_pressed(BTN_LEFT);
 }
 
 int right_held(){
-	if ((~PINC & _BV(SWE)) && !down) {
-		return 1;
-		down = 1;
-	} else {
-		down = 0;
-	}
-	return 0;
+	return switch_held(BTN_RIGHT);
 }
 
 int up_held(){
-	if ((~PINC & _BV(SWN)) && !down) {
-		return 1;
-		down = 1;
-	} else {
-		down = 0;
-	}
-	return 0;
+	return switch_held(BTN_UP);
+}
+
+int down_held(){
+	return switch_held(BTN_DOWN);
 }
 
 int left_held(){
-	if ((~PINC & _BV(SWW)) && !down) {
-		return 1;
-		down = 1;
-	} else {
-		down = 0;
-	}
-	return 0;
+	return switch_held(BTN_LEFT);
 }
@@ -1,3 +1,5 @@
+#include <stdint.h>
+
 #define SWN     PC2
 #define SWE     PC3
 #define SWS     PC4
@@ -19,7 +21,37 @@
  
 */
 
+/* Button numbers, used as bit positions in masks and in events. */
+#define BTN_UP      0
+#define BTN_RIGHT   1
+#define BTN_DOWN    2
+#define BTN_LEFT    3
+#define BTN_CENTER  4
+#define NO_BUTTONS  5
+
+#define EV_RELEASE  0
+#define EV_PRESS    1
+
+#define DEBOUNCE_MS 5  // Samples a change must be stable for.
+#define EVENT_QUEUE 16 // Power of two.
+
+typedef struct {
+	uint16_t time; // clock_now() of the first edge.
+	uint8_t button;
+	uint8_t type;
+} input_event;
+
+extern uint16_t input_latency_max; // us, event to input_tick().
+extern uint16_t input_dropped;
+
 void init_switches();
+uint8_t input_tick();
+uint8_t input_next(input_event *ev);
+uint8_t switch_held(uint8_t button);
+uint8_t switch_pressed(uint8_t button);
+uint8_t switch_released(uint8_t button);
+uint32_t switch_press_us(uint8_t button);
+
 int center_pressed();
 int left_pressed();
 int right_pressed();
@@ -0,0 +1,77 @@
+#include "telemetry.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+/*
+ * Frames are encoded straight into tx and clocked out by the UDRE
+ * interrupt. A frame that does not fit behind those still going out is
+ * dropped rather than waited for.
+ */
+uint8_t tx[TELE_BUFFER];
+volatile uint8_t tx_len = 0;
+volatile uint8_t tx_pos = 0;
+
+uint16_t telemetry_dropped = 0;
+
+void init_telemetry() {
+	UBRR1 = F_CPU / 8 / TELE_BAUD - 1;
+	UCSR1A = _BV(U2X1);
+	UCSR1C = _BV(UCSZ11) | _BV(UCSZ10); /* 8N1 */
+	UCSR1B = _BV(TXEN1);
+}
+
+/*
+ * Queues a frame for sending. Returns 0 if there is no room for it.
+ */
+uint8_t telemetry_send(uint8_t type, const void *payload, uint8_t len) {
+	const uint8_t *p = payload;
+	uint16_t crc = 0xFFFF;
+	uint8_t i, n;
+	
+	// The UDRE interrupt only ever shrinks the queue, so reading tx_len
+	// once is safe; everything after it is ours until tx_len moves.
+	n = tx_len;
+	if (len > TELE_MAX_PAYLOAD || n + len + 6 > TELE_BUFFER) {
+		telemetry_dropped++;
+		return 0;
+	}
+	
+	uint8_t *f = &tx[n];
+	f[0] = TELE_SYNC0;
+	f[1] = TELE_SYNC1;
+	f[2] = type;
+	f[3] = len;
+	crc = tele_crc_update(crc, type);
+	crc = tele_crc_update(crc, len);
+	for (i = 0; i < len; i++) {
+		f[4 + i] = p[i];
+		crc = tele_crc_update(crc, p[i]);
+	}
+	f[4 + len] = crc;
+	f[5 + len] = crc >> 8;
+	
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		if (tx_len == n) {
+			tx_len = n + len + 6;
+			UCSR1B |= _BV(UDRIE1);
+		} else {
+			// The queue drained while we wrote; restart at the front.
+			for (i = 0; i < len + 6; i++)
+				tx[i] = f[i];
+			tx_pos = 0;
+			tx_len = len + 6;
+			UCSR1B |= _BV(UDRIE1);
+		}
+	}
+	return 1;
+}
+
+ISR(USART1_UDRE_vect) {
+	UDR1 = tx[tx_pos++];
+	if (tx_pos == tx_len) {
+		UCSR1B &= ~_BV(UDRIE1);
+		tx_pos = 0;
+		tx_len = 0;
+	}
+}
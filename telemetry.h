@@ -0,0 +1,68 @@
+/*
+ * Binary telemetry out of USART1. Shared with the host decoder in tools/,
+ * so it must stay free of AVR-only code outside the __AVR__ block.
+ *
+ * Frame: SYNC0 SYNC1 type len payload[len] crc_lo crc_hi
+ * The CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over type, len
+ * and the payload. Multi-byte fields are little-endian.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+#define TELE_SYNC0 0xA5
+#define TELE_SYNC1 0x5A
+#define TELE_MAX_PAYLOAD 136 // The latency frame, the biggest.
+#define TELE_BUFFER 168 // Room for a latency frame plus a tick frame.
+#define TELE_BAUD 1000000UL
+
+#define TELE_TICK 0x01    // tele_tick, once per rendered frame.
+#define TELE_LATENCY 0x02 // tele_latency, every TELE_LATENCY_EVERY frames.
+#define TELE_LATENCY_EVERY 256
+#define TELE_TRACE 0x03   // trace_chunk + events, see trace.h.
+
+/* Phase times are in clock counts (1us at 8MHz, i.e. 8 cycles). */
+typedef struct {
+	uint16_t tick;            // Physics steps so far.
+	uint16_t step_t;          // All physics steps this frame.
+	uint16_t draw_t;
+	uint16_t frame_t;         // Whole ISR, including telemetry.
+	uint16_t lcd_budget_used; // render_budget spent, an estimate of bus bytes.
+	uint16_t missed;          // Total missed ticks.
+	uint8_t steps;            // Physics steps run this frame (>1 on catch-up).
+	uint8_t asteroids;
+	uint8_t bullets;
+	uint8_t debris;
+	uint8_t events;           // Input events consumed.
+	uint8_t held;             // Button mask, see switches.h.
+	uint8_t idle;             // Percent.
+} __attribute__((packed)) tele_tick;
+
+typedef struct {
+	uint16_t count;
+	uint16_t max_ms;
+	uint16_t bucket_us;
+	uint16_t hist[64];  // All LAT_BUCKETS of the histogram, overflow last.
+} __attribute__((packed)) tele_latency;
+
+#ifdef __AVR__
+#include <util/crc16.h>
+#define tele_crc_update(crc, b) _crc_xmodem_update(crc, b)
+#else
+static inline uint16_t tele_crc_update(uint16_t crc, uint8_t b) {
+	uint8_t i;
+	crc ^= (uint16_t) b << 8;
+	for (i = 0; i < 8; i++)
+		crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	return crc;
+}
+#endif
+
+void init_telemetry();
+uint8_t telemetry_send(uint8_t type, const void *payload, uint8_t len);
+
+extern uint16_t telemetry_dropped;
+
+#endif
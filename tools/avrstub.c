@@ -0,0 +1,8 @@
+/*
+ * Storage for the registers declared by tools/include/avr/io.h.
+ */
+
+#include <avr/io.h>
+
+#define HOST_REG_DEF(r) volatile uint8_t r;
+HOST_REGS(HOST_REG_DEF)
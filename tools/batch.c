@@ -0,0 +1,326 @@
+/*
+ * Plays thousands of seeded games on every core and summarises what the
+ * game asks of the hardware tick by tick: live entities, collision tests
+ * and the LCD bytes a frame would need with no render budget.
+ *
+ *   batch [-g games] [-t ticks] [-j threads] [-s first-seed]
+ *         [-p random|scripted|autopilot|stress] [-b budget]
+ *         [-k auto|scalar|sse2|avx2]
+ *
+ * Game i is seeded with first-seed + i, so any game in the summary can be
+ * replayed alone with headless -s. Games are dealt out to per-thread
+ * queues; a thread that runs dry steals from the others. Collisions go
+ * through the collide.c kernel chosen with -k, which gives the same games
+ * whichever it is.
+ */
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "collide.h"
+#include "game.h"
+#include "policy.h"
+#include "render.h"
+
+#define TEST_BUCKETS 256
+#define LCD_BUCKET 256 // Bytes per bucket of the LCD histogram.
+#define LCD_BUCKETS 256
+
+typedef struct {
+	unsigned long n;
+	double sum;
+	unsigned long max;
+	unsigned long *hist;
+	unsigned buckets;
+	unsigned width;
+} Metric;
+
+typedef struct {
+	uint16_t lcd;
+	uint16_t seed;
+	unsigned long tick;
+	uint8_t asteroids, bullets, debris;
+	uint32_t tests;
+} Frame;
+
+typedef struct {
+	unsigned long h_asteroids[NO_ASTEROIDS + 1];
+	unsigned long h_bullets[NO_BULLETS];
+	unsigned long h_debris[NO_DEBRIS];
+	unsigned long h_tests[TEST_BUCKETS];
+	unsigned long h_lcd[LCD_BUCKETS];
+	Metric asteroids, bullets, debris, tests, lcd;
+	unsigned long over_budget;
+	unsigned long deaths;
+	unsigned long games;
+	unsigned long steals;
+	Frame worst;
+} Stats;
+
+/* One thread's queue of games. The owner takes from the tail, thieves from
+ * the head. */
+typedef struct {
+	pthread_mutex_t lock;
+	int *games;
+	int head, tail;
+} Deque;
+
+typedef struct {
+	int id;
+	Stats stats;
+} Worker;
+
+static Deque *queues;
+static int threads;
+static unsigned long ticks = 6000; // Five minutes of play.
+static uint16_t first_seed = 1;
+static int kind = POLICY_RANDOM;
+static uint16_t budget = BUDGET_MAX;
+
+static void metric_init(Metric *m, unsigned long *hist, unsigned buckets,
+		unsigned width) {
+	memset(m, 0, sizeof(*m));
+	m->hist = hist;
+	m->buckets = buckets;
+	m->width = width;
+}
+
+static void metric_add(Metric *m, unsigned long v) {
+	unsigned b = v / m->width;
+	m->n++;
+	m->sum += v;
+	if (v > m->max)
+		m->max = v;
+	m->hist[b < m->buckets ? b : m->buckets - 1]++;
+}
+
+static void metric_merge(Metric *m, const Metric *o) {
+	unsigned i;
+	m->n += o->n;
+	m->sum += o->sum;
+	if (o->max > m->max)
+		m->max = o->max;
+	for (i = 0; i < m->buckets; i++)
+		m->hist[i] += o->hist[i];
+}
+
+/*
+ * Upper edge of the bucket holding the given percentile.
+ */
+static unsigned long metric_percentile(const Metric *m, unsigned percent) {
+	unsigned long want = (m->n * percent + 99) / 100, seen = 0;
+	unsigned i;
+	for (i = 0; i < m->buckets; i++) {
+		seen += m->hist[i];
+		if (seen >= want && seen)
+			return (unsigned long) (i + 1) * m->width - 1;
+	}
+	return m->max;
+}
+
+static void stats_init(Stats *s) {
+	memset(s, 0, sizeof(*s));
+	metric_init(&s->asteroids, s->h_asteroids, NO_ASTEROIDS + 1, 1);
+	metric_init(&s->bullets, s->h_bullets, NO_BULLETS, 1);
+	metric_init(&s->debris, s->h_debris, NO_DEBRIS, 1);
+	metric_init(&s->tests, s->h_tests, TEST_BUCKETS, 1);
+	metric_init(&s->lcd, s->h_lcd, LCD_BUCKETS, LCD_BUCKET);
+	s->worst.seed = UINT16_MAX;
+	s->worst.tick = ULONG_MAX;
+}
+
+/*
+ * Orders worst frames by bytes, then earliest seed and tick, so the one
+ * reported does not depend on which thread played what.
+ */
+static int worse(const Frame *a, const Frame *b) {
+	if (a->lcd != b->lcd)
+		return a->lcd > b->lcd;
+	if (a->seed != b->seed)
+		return a->seed < b->seed;
+	return a->tick < b->tick;
+}
+
+static void stats_merge(Stats *s, const Stats *o) {
+	metric_merge(&s->asteroids, &o->asteroids);
+	metric_merge(&s->bullets, &o->bullets);
+	metric_merge(&s->debris, &o->debris);
+	metric_merge(&s->tests, &o->tests);
+	metric_merge(&s->lcd, &o->lcd);
+	s->over_budget += o->over_budget;
+	s->deaths += o->deaths;
+	s->games += o->games;
+	s->steals += o->steals;
+	if (worse(&o->worst, &s->worst))
+		s->worst = o->worst;
+}
+
+static void play(int game, Stats *s) {
+	Game g;
+	Policy p;
+	unsigned long t;
+	uint16_t seed = first_seed + game;
+
+	game_init(&g, seed);
+	policy_init(&p, kind, seed * 2654435761u);
+	g.stress = kind == POLICY_STRESS;
+	for (t = 0; t < ticks; t++) {
+		uint8_t alive = g.ship.state != DEAD;
+		uint32_t tests = g.collision_tests;
+		Frame f;
+
+		game_step(&g, policy_next(&p, &g));
+
+		f.lcd = render_cost(&g);
+		f.asteroids = game_asteroids(&g);
+		f.bullets = game_bullets(&g);
+		f.debris = game_debris(&g);
+		f.tests = g.collision_tests - tests;
+		metric_add(&s->asteroids, f.asteroids);
+		metric_add(&s->bullets, f.bullets);
+		metric_add(&s->debris, f.debris);
+		metric_add(&s->tests, f.tests);
+		metric_add(&s->lcd, f.lcd);
+		if (f.lcd > budget)
+			s->over_budget++;
+		if (alive && g.ship.state == DEAD)
+			s->deaths++;
+		f.seed = seed;
+		f.tick = t;
+		if (worse(&f, &s->worst))
+			s->worst = f;
+	}
+	s->games++;
+}
+
+static int take(Deque *q, int steal) {
+	int game = -1;
+	pthread_mutex_lock(&q->lock);
+	if (q->head < q->tail)
+		game = steal ? q->games[q->head++] : q->games[--q->tail];
+	pthread_mutex_unlock(&q->lock);
+	return game;
+}
+
+static void *work(void *arg) {
+	Worker *w = arg;
+	int game, i;
+
+	for (;;) {
+		game = take(&queues[w->id], 0);
+		for (i = 1; game < 0 && i < threads; i++) {
+			game = take(&queues[(w->id + i) % threads], 1);
+			if (game >= 0)
+				w->stats.steals++;
+		}
+		if (game < 0)
+			return NULL;
+		play(game, &w->stats);
+	}
+}
+
+static void row(const char *name, const Metric *m) {
+	printf("%-12s %8.1f %6lu %6lu %6lu %6lu\n", name, m->n ? m->sum / m->n : 0,
+		metric_percentile(m, 50), metric_percentile(m, 90),
+		metric_percentile(m, 99), m->max);
+}
+
+int main(int argc, char **argv) {
+	int games = 1000, opt, i;
+	const char *kernel = collide_select(NULL);
+	struct timespec t0, t1;
+	Worker *workers;
+	pthread_t *ids;
+	Stats total;
+
+	threads = sysconf(_SC_NPROCESSORS_ONLN);
+	while ((opt = getopt(argc, argv, "g:t:j:s:p:b:k:")) != -1) {
+		switch (opt) {
+		case 'g':
+			games = atoi(optarg);
+			break;
+		case 't':
+			ticks = strtoul(optarg, NULL, 0);
+			break;
+		case 'j':
+			threads = atoi(optarg);
+			break;
+		case 's':
+			first_seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			kind = policy_parse(optarg);
+			if (kind < 0) {
+				fprintf(stderr, "unknown policy %s\n", optarg);
+				return 1;
+			}
+			break;
+		case 'b':
+			budget = strtoul(optarg, NULL, 0);
+			break;
+		case 'k':
+			kernel = collide_select(optarg);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-g games] [-t ticks] [-j threads] "
+				"[-s first-seed] [-p random|scripted|autopilot|stress] [-b budget] "
+				"[-k auto|scalar|sse2|avx2]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (threads < 1)
+		threads = 1;
+	if (games < 1)
+		games = 1;
+
+	// Deal the games out in contiguous runs, one per thread.
+	queues = calloc(threads, sizeof(*queues));
+	workers = calloc(threads, sizeof(*workers));
+	ids = calloc(threads, sizeof(*ids));
+	for (i = 0; i < threads; i++) {
+		int lo = (long) games * i / threads, hi = (long) games * (i + 1) / threads;
+		int k;
+		pthread_mutex_init(&queues[i].lock, NULL);
+		queues[i].games = malloc((hi - lo + 1) * sizeof(int));
+		for (k = lo; k < hi; k++)
+			queues[i].games[queues[i].tail++] = k;
+		workers[i].id = i;
+		stats_init(&workers[i].stats);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < threads; i++)
+		pthread_create(&ids[i], NULL, work, &workers[i]);
+	stats_init(&total);
+	for (i = 0; i < threads; i++) {
+		pthread_join(ids[i], NULL);
+		stats_merge(&total, &workers[i].stats);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double s = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+	printf("%lu games x %lu ticks (%s), %d threads, %s collisions, %.2fs, "
+		"%.2f Mticks/s, %lu steals\n", total.games, ticks,
+		policy_name(kind), threads, kernel, s,
+		total.lcd.n / s / 1e6, total.steals);
+	printf("%-12s %8s %6s %6s %6s %6s\n", "per tick", "mean", "p50", "p90",
+		"p99", "max");
+	row("asteroids", &total.asteroids);
+	row("bullets", &total.bullets);
+	row("debris", &total.debris);
+	row("tests", &total.tests);
+	row("lcd bytes", &total.lcd);
+	printf("over %u byte budget: %.3f%% of frames; deaths %.1f per game\n",
+		budget, 100.0 * total.over_budget / total.lcd.n,
+		(double) total.deaths / total.games);
+	printf("worst frame: seed %u tick %lu, %u bytes, %u asteroids, "
+		"%u bullets, %u debris, %u tests\n", total.worst.seed,
+		total.worst.tick, total.worst.lcd, total.worst.asteroids,
+		total.worst.bullets, total.worst.debris, total.worst.tests);
+	return 0;
+}
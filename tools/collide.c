@@ -0,0 +1,107 @@
+#include "collide.h"
+
+#include <string.h>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+collide_fn collide = collide_scalar;
+
+/*
+ * Copies n asteroids into b. The far edges are summed here in float, the
+ * same way the scalar test computes origin + size, and unused lanes get
+ * empty boxes that nothing is inside.
+ */
+void collide_load(Boxes *b, const Asteroid *a, uint8_t n) {
+	uint8_t i;
+	memset(b, 0, sizeof(*b));
+	for (i = 0; i < n && i < COLLIDE_LANES; i++) {
+		b->x0[i] = a[i].origin.x;
+		b->x1[i] = a[i].origin.x + a[i].size;
+		b->y0[i] = a[i].origin.y;
+		b->y1[i] = a[i].origin.y + a[i].size;
+		if (a[i].size > 0)
+			b->live |= 1 << i;
+	}
+}
+
+uint16_t collide_scalar(const Boxes *b, float x, float y) {
+	uint16_t hits = 0;
+	uint8_t i;
+	for (i = 0; i < COLLIDE_LANES; i++)
+		if (x > b->x0[i] && x < b->x1[i] && y > b->y0[i] && y < b->y1[i])
+			hits |= 1 << i;
+	return hits;
+}
+
+#ifdef __x86_64__
+/* Four boxes per compare, unrolled to eight per pass like the AVX2 one. */
+static inline int sse2_quad(const Boxes *b, int i, __m128 px, __m128 py) {
+	__m128 in = _mm_and_ps(
+		_mm_and_ps(_mm_cmpgt_ps(px, _mm_load_ps(&b->x0[i])),
+			_mm_cmplt_ps(px, _mm_load_ps(&b->x1[i]))),
+		_mm_and_ps(_mm_cmpgt_ps(py, _mm_load_ps(&b->y0[i])),
+			_mm_cmplt_ps(py, _mm_load_ps(&b->y1[i]))));
+	return _mm_movemask_ps(in);
+}
+
+uint16_t collide_sse2(const Boxes *b, float x, float y) {
+	__m128 px = _mm_set1_ps(x), py = _mm_set1_ps(y);
+	uint16_t hits = 0;
+	int i;
+	for (i = 0; i < COLLIDE_LANES; i += 8)
+		hits |= (sse2_quad(b, i, px, py) | sse2_quad(b, i + 4, px, py) << 4)
+			<< i;
+	return hits;
+}
+
+__attribute__((target("avx2")))
+uint16_t collide_avx2(const Boxes *b, float x, float y) {
+	__m256 px = _mm256_set1_ps(x), py = _mm256_set1_ps(y);
+	uint16_t hits = 0;
+	int i;
+	for (i = 0; i < COLLIDE_LANES; i += 8) {
+		// Ordered, non-signalling compares: false for NaN, like C's > and <.
+		__m256 in = _mm256_and_ps(
+			_mm256_and_ps(
+				_mm256_cmp_ps(px, _mm256_load_ps(&b->x0[i]), _CMP_GT_OQ),
+				_mm256_cmp_ps(px, _mm256_load_ps(&b->x1[i]), _CMP_LT_OQ)),
+			_mm256_and_ps(
+				_mm256_cmp_ps(py, _mm256_load_ps(&b->y0[i]), _CMP_GT_OQ),
+				_mm256_cmp_ps(py, _mm256_load_ps(&b->y1[i]), _CMP_LT_OQ)));
+		hits |= _mm256_movemask_ps(in) << i;
+	}
+	return hits;
+}
+#else
+uint16_t collide_sse2(const Boxes *b, float x, float y) {
+	return collide_scalar(b, x, y);
+}
+
+uint16_t collide_avx2(const Boxes *b, float x, float y) {
+	return collide_scalar(b, x, y);
+}
+#endif
+
+/*
+ * Picks the kernel by name ("scalar", "sse2", "avx2"), or the widest the
+ * CPU runs for "auto" or NULL. Returns the name of the one in use.
+ */
+const char *collide_select(const char *name) {
+	int want_auto = !name || !strcmp(name, "auto");
+#ifdef __x86_64__
+	__builtin_cpu_init();
+	if ((want_auto || !strcmp(name, "avx2")) && __builtin_cpu_supports("avx2")) {
+		collide = collide_avx2;
+		return "avx2";
+	}
+	if (want_auto || !strcmp(name, "sse2") || !strcmp(name, "avx2")) {
+		collide = collide_sse2;
+		return "sse2";
+	}
+#else
+	(void) want_auto;
+#endif
+	collide = collide_scalar;
+	return "scalar";
+}
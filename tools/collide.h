@@ -0,0 +1,36 @@
+/*
+ * Point-in-box tests against all asteroids at once, for host builds of the
+ * game core (-DGAME_COLLIDE). The boxes are kept as a structure of arrays
+ * so each pass of either kernel tests 8 asteroids: two 4-lane compares for
+ * SSE2, one 8-lane compare for AVX2. The result is a bitmask with bit i set
+ * when the point is strictly inside box i, exactly as the scalar test in
+ * game.c decides it.
+ */
+
+#ifndef COLLIDE_H
+#define COLLIDE_H
+
+#include <stdint.h>
+#include "game.h"
+
+#define COLLIDE_LANES 16
+
+typedef struct {
+	float x0[COLLIDE_LANES] __attribute__((aligned(32)));
+	float x1[COLLIDE_LANES] __attribute__((aligned(32)));
+	float y0[COLLIDE_LANES] __attribute__((aligned(32)));
+	float y1[COLLIDE_LANES] __attribute__((aligned(32)));
+	uint16_t live; // Bit i set if asteroid i has a size.
+} Boxes;
+
+typedef uint16_t (*collide_fn)(const Boxes *b, float x, float y);
+
+extern collide_fn collide;
+
+void collide_load(Boxes *b, const Asteroid *a, uint8_t n);
+uint16_t collide_scalar(const Boxes *b, float x, float y);
+uint16_t collide_sse2(const Boxes *b, float x, float y);
+uint16_t collide_avx2(const Boxes *b, float x, float y);
+const char *collide_select(const char *name);
+
+#endif
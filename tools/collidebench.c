@@ -0,0 +1,223 @@
+/*
+ * Checks the collide.c kernels against the collision rule in game.c and
+ * measures how many asteroid box tests per second each one does.
+ *
+ *   collidebench [-n cases] [-r rounds]
+ *
+ * The check feeds bullet and ship points at random asteroid fields, with a
+ * good share landing exactly on box edges, and stops at the first
+ * disagreement.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "collide.h"
+
+#define POINTS 4096
+
+static const uint8_t sizes[] = { 0, SMALL_SIZE, MID_SIZE, BIG_SIZE };
+
+static uint32_t rng = 0x9E3779B9;
+
+static uint32_t next() {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+/* Anywhere the game puts things, on whole, half or arbitrary coordinates. */
+static float coord() {
+	float v = (int) (next() % 420) - 60;
+	switch (next() % 3) {
+	case 0:
+		return v;
+	case 1:
+		return v + 0.5f;
+	default:
+		return v + (next() % 1000) / 1000.0f;
+	}
+}
+
+static void field(Asteroid *a) {
+	uint8_t i;
+	for (i = 0; i < NO_ASTEROIDS; i++) {
+		a[i].origin.x = coord();
+		a[i].origin.y = coord();
+		a[i].size = sizes[next() % 4];
+	}
+}
+
+/*
+ * The bullet test from update(), verbatim apart from returning every
+ * asteroid hit rather than the first.
+ */
+static uint16_t bullet_rule(const Asteroid *asteroids, const Bullet *b) {
+	uint16_t hits = 0;
+	uint8_t j;
+	for (j = 0; j < NO_ASTEROIDS; j++) {
+		const Asteroid *a = &asteroids[j];
+		if (a->size > 0 &&
+				((b->x > a->origin.x &&
+				b->x < a->origin.x + a->size &&
+				b->y > a->origin.y &&
+				b->y < a->origin.y + a->size)
+				|| (b->x-b->x_inc/2 > a->origin.x &&
+				b->x-b->x_inc/2 < a->origin.x + a->size &&
+				b->y-b->y_inc/2 > a->origin.y &&
+				b->y-b->y_inc/2 < a->origin.y + a->size)))
+			hits |= 1 << j;
+	}
+	return hits;
+}
+
+/* The ship point test from check_collision(). */
+static uint16_t ship_rule(const Asteroid *asteroids, Point p) {
+	uint16_t hits = 0;
+	uint8_t i;
+	for (i = 0; i < NO_ASTEROIDS; i++) {
+		const Asteroid *a = &asteroids[i];
+		if (p.x > a->origin.x
+			&& p.x < a->origin.x + a->size
+			&& p.y > a->origin.y
+			&& p.y < a->origin.y + a->size)
+			hits |= 1 << i;
+	}
+	return hits;
+}
+
+/* Somewhere near asteroid a, often exactly on one of its edges. */
+static float near(float lo, uint8_t size) {
+	switch (next() % 4) {
+	case 0:
+		return lo;
+	case 1:
+		return lo + size;
+	default:
+		return lo + (int) (next() % (size + 11)) - 5;
+	}
+}
+
+static int check(const char *name, collide_fn fn, unsigned long cases) {
+	Asteroid a[NO_ASTEROIDS];
+	Boxes boxes;
+	unsigned long n;
+
+	rng = 0x9E3779B9;
+	for (n = 0; n < cases; n++) {
+		Bullet b;
+		Point p;
+		uint16_t want, got;
+		const Asteroid *t;
+
+		if (n % 64 == 0) {
+			field(a);
+			collide_load(&boxes, a, NO_ASTEROIDS);
+		}
+		t = &a[next() % NO_ASTEROIDS];
+
+		b.x = near(t->origin.x, t->size);
+		b.y = near(t->origin.y, t->size);
+		b.x_inc = (int) (next() % 21) - 10;
+		b.y_inc = (int) (next() % 21) - 10;
+		want = bullet_rule(a, &b);
+		got = boxes.live & (fn(&boxes, b.x, b.y)
+			| fn(&boxes, b.x-b.x_inc/2, b.y-b.y_inc/2));
+		if (got != want) {
+			printf("%s: bullet (%u,%u)+(%d,%d) gives %04x, rule says %04x\n",
+				name, b.x, b.y, b.x_inc, b.y_inc, got, want);
+			return 1;
+		}
+
+		p.x = next() & 1 ? near(t->origin.x, t->size) : coord();
+		p.y = next() & 1 ? near(t->origin.y, t->size) : coord();
+		want = ship_rule(a, p);
+		got = fn(&boxes, p.x, p.y);
+		if (got != want) {
+			printf("%s: point (%g,%g) gives %04x, rule says %04x\n",
+				name, p.x, p.y, got, want);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void bench(const char *name, collide_fn fn, unsigned long rounds) {
+	static float px[POINTS], py[POINTS];
+	Asteroid a[NO_ASTEROIDS];
+	Boxes boxes;
+	struct timespec t0, t1;
+	unsigned long r;
+	unsigned i;
+	uint32_t sink = 0;
+
+	rng = 1;
+	field(a);
+	collide_load(&boxes, a, NO_ASTEROIDS);
+	for (i = 0; i < POINTS; i++) {
+		px[i] = coord();
+		py[i] = coord();
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (r = 0; r < rounds; r++)
+		for (i = 0; i < POINTS; i++)
+			sink += fn(&boxes, px[i], py[i]);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	double s = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	double points = (double) rounds * POINTS;
+	printf("%-8s %8.1f Mpoints/s %8.1f M asteroid tests/s %6.2f ns/point"
+		"  (%08x)\n", name, points / s / 1e6,
+		points * NO_ASTEROIDS / s / 1e6, s / points * 1e9, sink);
+}
+
+int main(int argc, char **argv) {
+	static const struct {
+		const char *name;
+		collide_fn fn;
+	} kernels[] = {
+		{ "scalar", collide_scalar },
+		{ "sse2", collide_sse2 },
+		{ "avx2", collide_avx2 },
+	};
+	unsigned long cases = 10000000, rounds = 2000;
+	int opt, k, failed = 0;
+
+	while ((opt = getopt(argc, argv, "n:r:")) != -1) {
+		switch (opt) {
+		case 'n':
+			cases = strtoul(optarg, NULL, 0);
+			break;
+		case 'r':
+			rounds = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n cases] [-r rounds]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	for (k = 0; k < 3; k++) {
+		if (k == 2 && strcmp(collide_select("avx2"), "avx2")) {
+			printf("avx2: not supported here, skipped\n");
+			continue;
+		}
+		if (check(kernels[k].name, kernels[k].fn, cases))
+			failed = 1;
+		else
+			printf("%s: %lu cases match the game's rule\n", kernels[k].name,
+				cases);
+	}
+	if (failed)
+		return 1;
+
+	for (k = 0; k < 3; k++)
+		if (k < 2 || !strcmp(collide_select("avx2"), "avx2"))
+			bench(kernels[k].name, kernels[k].fn, rounds);
+	return 0;
+}
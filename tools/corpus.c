@@ -0,0 +1,288 @@
+#include "corpus.h"
+#include "render.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const char *const corpus_game_names[CORPUS_GAME_METRICS] = {
+	"lcd", "asteroids", "bullets", "debris", "tests",
+};
+const uint8_t corpus_game_widths[CORPUS_GAME_METRICS] = { 2, 1, 1, 1, 2 };
+
+static uint64_t align(uint64_t n) {
+	return (n + CORPUS_ALIGN - 1) & ~(uint64_t) (CORPUS_ALIGN - 1);
+}
+
+static int column_fits(const Corpus *c, uint64_t offset, uint64_t n,
+		uint64_t width) {
+	return offset % CORPUS_ALIGN == 0 && offset <= c->size
+		&& n <= (c->size - offset) / width;
+}
+
+/*
+ * Points the column pointers into the mapping, checking that each column
+ * lies inside the file and that the replays' ticks run in order within
+ * it. Returns -1 if the header or the index does not hold together.
+ */
+static int attach(Corpus *c) {
+	const corpus_header *h = (const corpus_header *) c->base;
+	uint64_t r;
+	uint32_t m;
+
+	if (c->size < sizeof(*h) || memcmp(h->magic, CORPUS_MAGIC, 8)
+			|| h->version != CORPUS_VERSION || h->metrics > CORPUS_METRICS
+			|| h->replays >= UINT64_MAX / 8
+			|| !column_fits(c, h->seed, h->replays, 2)
+			|| !column_fits(c, h->flags, h->replays, 1)
+			|| !column_fits(c, h->start, h->replays + 1, 8)
+			|| !column_fits(c, h->held, h->ticks, 1)
+			|| !column_fits(c, h->pressed, h->ticks, 1)
+			|| !column_fits(c, h->turn, h->ticks, 1))
+		return -1;
+	for (m = 0; m < h->metrics; m++) {
+		const corpus_column *k = &h->metric[m];
+		if ((k->width != 1 && k->width != 2 && k->width != 4)
+				|| !column_fits(c, k->offset, h->ticks, k->width))
+			return -1;
+	}
+	c->h = h;
+	c->seed = (const uint16_t *) (c->base + h->seed);
+	c->flags = c->base + h->flags;
+	c->start = (const uint64_t *) (c->base + h->start);
+	c->held = c->base + h->held;
+	c->pressed = c->base + h->pressed;
+	c->turn = (const int8_t *) (c->base + h->turn);
+	// A fresh file's index is all zeros, which passes; it is filled in
+	// order as replays begin.
+	for (r = 0; r < h->replays; r++)
+		if (c->start[r] > c->start[r + 1])
+			return -1;
+	if (c->start[h->replays] > h->ticks)
+		return -1;
+	return 0;
+}
+
+/*
+ * Maps a corpus read-only. Returns -1 with errno set on failure (EINVAL
+ * for a file that is not a valid corpus).
+ */
+int corpus_open(Corpus *c, const char *path) {
+	struct stat st;
+	int fd = open(path, O_RDONLY);
+
+	memset(c, 0, sizeof(*c));
+	if (fd < 0)
+		return -1;
+	if (fstat(fd, &st)) {
+		close(fd);
+		return -1;
+	}
+	c->size = st.st_size;
+	c->base = c->size ? mmap(NULL, c->size, PROT_READ, MAP_PRIVATE, fd, 0)
+		: MAP_FAILED;
+	close(fd);
+	if (c->base == MAP_FAILED) {
+		c->base = NULL;
+		errno = c->size ? errno : EINVAL;
+		return -1;
+	}
+	madvise(c->base, c->size, MADV_SEQUENTIAL);
+	if (attach(c) || c->start[c->h->replays] != c->h->ticks) {
+		corpus_close(c);
+		errno = EINVAL;
+		return -1;
+	}
+	return 0;
+}
+
+void corpus_close(Corpus *c) {
+	if (c->base)
+		munmap(c->base, c->size);
+	memset(c, 0, sizeof(*c));
+}
+
+uint64_t corpus_ticks(const Corpus *c, uint64_t r) {
+	return c->start[r + 1] - c->start[r];
+}
+
+/*
+ * Input for tick `tick` of replay r.
+ */
+void corpus_input(const Corpus *c, uint64_t r, uint64_t tick, GameInput *in) {
+	uint64_t i = c->start[r] + tick;
+	in->held = c->held[i];
+	in->pressed = c->pressed[i];
+	in->turn = c->turn[i];
+}
+
+/*
+ * Index of the metric column with the given name, or -1.
+ */
+int corpus_metric(const Corpus *c, const char *name) {
+	uint32_t m;
+	for (m = 0; m < c->h->metrics; m++)
+		if (!strncmp(c->h->metric[m].name, name, CORPUS_NAME))
+			return m;
+	return -1;
+}
+
+/*
+ * The whole of metric column m, indexed by c->start[r] + tick.
+ */
+const void *corpus_column_of(const Corpus *c, int m) {
+	return c->base + c->h->metric[m].offset;
+}
+
+uint32_t corpus_value(const Corpus *c, int m, uint64_t r, uint64_t tick) {
+	const uint8_t *p = corpus_column_of(c, m);
+	uint64_t i = c->start[r] + tick;
+	switch (c->h->metric[m].width) {
+	case 1:
+		return p[i];
+	case 2:
+		return ((const uint16_t *) p)[i];
+	default:
+		return ((const uint32_t *) p)[i];
+	}
+}
+
+/*
+ * Creates a corpus for exactly `replays` replays and `ticks` ticks in all,
+ * mapped so corpus_begin() and corpus_put() write straight into the file.
+ */
+int corpus_create(CorpusWriter *w, const char *path, uint64_t replays,
+		uint64_t ticks, const char *const *names, const uint8_t *widths,
+		int metrics) {
+	corpus_header h;
+	uint64_t at;
+	int fd, m;
+
+	memset(w, 0, sizeof(*w));
+	if (metrics < 0 || metrics > CORPUS_METRICS) {
+		errno = EINVAL;
+		return -1;
+	}
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, CORPUS_MAGIC, 8);
+	h.version = CORPUS_VERSION;
+	h.metrics = metrics;
+	h.replays = replays;
+	h.ticks = ticks;
+	at = align(sizeof(h));
+	h.seed = at;
+	at = align(at + replays * 2);
+	h.flags = at;
+	at = align(at + replays);
+	h.start = at;
+	at = align(at + (replays + 1) * 8);
+	h.held = at;
+	at = align(at + ticks);
+	h.pressed = at;
+	at = align(at + ticks);
+	h.turn = at;
+	at = align(at + ticks);
+	for (m = 0; m < metrics; m++) {
+		strncpy(h.metric[m].name, names[m], CORPUS_NAME);
+		h.metric[m].width = widths[m];
+		h.metric[m].offset = at;
+		at = align(at + ticks * widths[m]);
+	}
+
+	fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return -1;
+	if (ftruncate(fd, at)) {
+		close(fd);
+		return -1;
+	}
+	w->c.size = at;
+	w->c.base = mmap(NULL, at, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (w->c.base == MAP_FAILED) {
+		w->c.base = NULL;
+		return -1;
+	}
+	memcpy(w->c.base, &h, sizeof(h));
+	if (attach(&w->c)) {
+		corpus_close(&w->c);
+		errno = EINVAL;
+		return -1;
+	}
+	return 0;
+}
+
+void corpus_begin(CorpusWriter *w, uint16_t seed, uint8_t flags) {
+	if (w->replay == w->c.h->replays)
+		return;
+	((uint16_t *) w->c.seed)[w->replay] = seed;
+	((uint8_t *) w->c.flags)[w->replay] = flags;
+	((uint64_t *) w->c.start)[w->replay] = w->tick;
+	w->replay++;
+}
+
+/*
+ * Appends a tick of input, and its metrics if the corpus has any, to the
+ * replay begun last.
+ */
+void corpus_put(CorpusWriter *w, const GameInput *in, const uint32_t *values) {
+	const corpus_header *h = w->c.h;
+	uint64_t i = w->tick;
+	uint32_t m;
+
+	if (i == h->ticks || w->replay == 0)
+		return;
+	w->tick++;
+	((uint8_t *) w->c.held)[i] = in->held;
+	((uint8_t *) w->c.pressed)[i] = in->pressed;
+	((int8_t *) w->c.turn)[i] = in->turn;
+	for (m = 0; m < h->metrics; m++) {
+		uint8_t *p = w->c.base + h->metric[m].offset;
+		switch (h->metric[m].width) {
+		case 1:
+			p[i] = values[m];
+			break;
+		case 2:
+			((uint16_t *) p)[i] = values[m];
+			break;
+		default:
+			((uint32_t *) p)[i] = values[m];
+			break;
+		}
+	}
+}
+
+/*
+ * Closes off the index and unmaps the file. Fails if fewer replays or
+ * ticks were written than corpus_create() was told.
+ */
+int corpus_finish(CorpusWriter *w) {
+	int ok = w->replay == w->c.h->replays && w->tick == w->c.h->ticks;
+	((uint64_t *) w->c.start)[w->replay] = w->tick;
+	if (msync(w->c.base, w->c.size, MS_SYNC))
+		ok = 0;
+	corpus_close(&w->c);
+	if (!ok) {
+		errno = EINVAL;
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * Steps g on in and measures the tick into values, in the order of
+ * corpus_game_names.
+ */
+void corpus_measure(Game *g, const GameInput *in, uint32_t *values) {
+	uint32_t tests = g->collision_tests;
+	game_step(g, in);
+	values[0] = render_cost(g);
+	values[1] = game_asteroids(g);
+	values[2] = game_bullets(g);
+	values[3] = game_debris(g);
+	values[4] = g->collision_tests - tests;
+}
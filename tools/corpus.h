@@ -0,0 +1,95 @@
+/*
+ * Replay corpus: many recorded games in one file, stored column by column
+ * so the host tools can mmap it and walk the data in place.
+ *
+ * The file is a corpus_header followed by its columns, each starting on a
+ * CORPUS_ALIGN boundary at the offset the header gives:
+ *
+ *   seed[replays]      uint16_t  game_init() seed
+ *   flags[replays]     uint8_t   REPLAY_* flags (replay.h)
+ *   start[replays + 1] uint64_t  first tick of each replay; the last entry
+ *                                is the total, so replay r has
+ *                                start[r + 1] - start[r] ticks
+ *   held[ticks]        uint8_t   GameInput.held
+ *   pressed[ticks]     uint8_t   GameInput.pressed
+ *   turn[ticks]        int8_t    GameInput.turn
+ *
+ * and optionally up to CORPUS_METRICS named per-tick metric columns of 1,
+ * 2 or 4 byte unsigned values, measured after the tick's game_step().
+ * Everything is little-endian.
+ */
+
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "game.h"
+
+#define CORPUS_MAGIC "FACORPUS"
+#define CORPUS_VERSION 1
+#define CORPUS_ALIGN 64
+#define CORPUS_METRICS 8
+#define CORPUS_NAME 16
+
+// The metrics the tools record: LCD bytes with no render budget
+// (render_cost()), live asteroids, bullets and debris, collision tests.
+#define CORPUS_GAME_METRICS 5
+extern const char *const corpus_game_names[CORPUS_GAME_METRICS];
+extern const uint8_t corpus_game_widths[CORPUS_GAME_METRICS];
+
+typedef struct {
+	char name[CORPUS_NAME];
+	uint32_t width;
+	uint32_t reserved;
+	uint64_t offset;
+} corpus_column;
+
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t metrics;
+	uint64_t replays;
+	uint64_t ticks;
+	uint64_t seed, flags, start; // Column offsets.
+	uint64_t held, pressed, turn;
+	corpus_column metric[CORPUS_METRICS];
+} corpus_header;
+
+typedef struct {
+	uint8_t *base;
+	size_t size;
+	const corpus_header *h;
+	const uint16_t *seed;
+	const uint8_t *flags;
+	const uint64_t *start;
+	const uint8_t *held;
+	const uint8_t *pressed;
+	const int8_t *turn;
+} Corpus;
+
+typedef struct {
+	Corpus c;
+	uint64_t replay; // Replays begun.
+	uint64_t tick;   // Ticks put.
+} CorpusWriter;
+
+int corpus_open(Corpus *c, const char *path);
+void corpus_close(Corpus *c);
+uint64_t corpus_ticks(const Corpus *c, uint64_t r);
+void corpus_input(const Corpus *c, uint64_t r, uint64_t tick, GameInput *in);
+int corpus_metric(const Corpus *c, const char *name);
+const void *corpus_column_of(const Corpus *c, int m);
+uint32_t corpus_value(const Corpus *c, int m, uint64_t r, uint64_t tick);
+
+int corpus_create(CorpusWriter *w, const char *path, uint64_t replays,
+	uint64_t ticks, const char *const *names, const uint8_t *widths,
+	int metrics);
+void corpus_begin(CorpusWriter *w, uint16_t seed, uint8_t flags);
+void corpus_put(CorpusWriter *w, const GameInput *in, const uint32_t *values);
+int corpus_finish(CorpusWriter *w);
+
+void corpus_measure(Game *g, const GameInput *in, uint32_t *values);
+
+#endif
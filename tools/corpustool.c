@@ -0,0 +1,374 @@
+/*
+ * Builds and reads replay corpora (corpus.h).
+ *
+ *   corpus gen [-g games] [-t ticks] [-s first-seed] [-p policy] [-m] out
+ *   corpus convert [-m] out eeprom.bin...
+ *   corpus info file
+ *   corpus scan file
+ *   corpus show file replay [tick [count]]
+ *   corpus verify file
+ *
+ * gen plays games under one of the policy.c policies; convert takes games
+ * recorded on the device or by headless -w. -m adds the per-tick metrics
+ * batch reports: LCD bytes with no budget, live entities and collision
+ * tests. scan walks every column in place and summarises it, show prints
+ * ticks of one replay, and verify replays every game through game.c and
+ * checks it against the stored metrics.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "corpus.h"
+#include "eeimage.h"
+#include "game.h"
+#include "policy.h"
+#include "render.h"
+
+static double now() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static void start(Game *g, uint16_t seed, uint8_t flags) {
+	game_init(g, seed);
+	g->stress = flags & REPLAY_STRESS;
+	g->state = PLAY_STATE;
+}
+
+static int created(int err, const char *path) {
+	if (err)
+		perror(path);
+	return err ? 1 : 0;
+}
+
+static int gen(int argc, char **argv) {
+	unsigned long games = 100, ticks = 6000, i, t;
+	int kind = POLICY_RANDOM, metrics = 0, opt;
+	uint16_t first = 1;
+	CorpusWriter w;
+	static Game g;
+
+	while ((opt = getopt(argc, argv, "g:t:s:p:m")) != -1) {
+		switch (opt) {
+		case 'g':
+			games = strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			ticks = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			first = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			kind = policy_parse(optarg);
+			if (kind < 0) {
+				fprintf(stderr, "unknown policy %s\n", optarg);
+				return 1;
+			}
+			break;
+		case 'm':
+			metrics = CORPUS_GAME_METRICS;
+			break;
+		default:
+			return -1;
+		}
+	}
+	if (optind != argc - 1)
+		return -1;
+	if (corpus_create(&w, argv[optind], games, games * ticks,
+			corpus_game_names, corpus_game_widths, metrics))
+		return created(errno, argv[optind]);
+
+	for (i = 0; i < games; i++) {
+		uint16_t seed = first + i;
+		uint8_t flags = kind == POLICY_STRESS ? REPLAY_STRESS : 0;
+		uint32_t v[CORPUS_GAME_METRICS];
+		Policy p;
+
+		start(&g, seed, flags);
+		policy_init(&p, kind, seed * 2654435761u);
+		corpus_begin(&w, seed, flags);
+		for (t = 0; t < ticks; t++) {
+			const GameInput *in = policy_next(&p, &g);
+			corpus_measure(&g, in, v);
+			corpus_put(&w, in, v);
+		}
+	}
+	if (corpus_finish(&w))
+		return created(errno, argv[optind]);
+	printf("%lu games x %lu ticks (%s) to %s\n", games, ticks,
+		policy_name(kind), argv[optind]);
+	return 0;
+}
+
+static uint8_t *image;
+
+static uint8_t image_read(uint16_t addr) {
+	return image[addr];
+}
+
+/*
+ * Ticks in the recording in ee, or -1 if there is none.
+ */
+static long recorded(uint8_t *ee, replay_header *h) {
+	ReplayDec d;
+	GameInput in;
+	long n = 0;
+	if (ee_header(ee, h))
+		return -1;
+	image = ee;
+	replay_dec_init(&d, image_read);
+	while (replay_next(&d, &in))
+		n++;
+	return n;
+}
+
+static int convert(int argc, char **argv) {
+	int metrics = 0, opt, i, files;
+	unsigned long ticks = 0;
+	uint8_t (*ee)[EE_SIZE];
+	static Game g;
+	CorpusWriter w;
+	replay_header h;
+
+	while ((opt = getopt(argc, argv, "m")) != -1) {
+		if (opt != 'm')
+			return -1;
+		metrics = CORPUS_GAME_METRICS;
+	}
+	if (optind > argc - 2)
+		return -1;
+	files = argc - optind - 1;
+	ee = malloc(files * sizeof(*ee));
+	for (i = 0; i < files; i++) {
+		const char *path = argv[optind + 1 + i];
+		long n;
+		if (ee_load(path, ee[i])) {
+			perror(path);
+			return 1;
+		}
+		n = recorded(ee[i], &h);
+		if (n < 0) {
+			fprintf(stderr, "%s: no recording in it\n", path);
+			return 1;
+		}
+		ticks += n;
+	}
+
+	if (corpus_create(&w, argv[optind], files, ticks, corpus_game_names,
+			corpus_game_widths, metrics))
+		return created(errno, argv[optind]);
+	for (i = 0; i < files; i++) {
+		uint32_t v[CORPUS_GAME_METRICS];
+		ReplayDec d;
+		GameInput in;
+
+		ee_header(ee[i], &h);
+		start(&g, h.seed, h.flags);
+		corpus_begin(&w, h.seed, h.flags);
+		image = ee[i];
+		replay_dec_init(&d, image_read);
+		while (replay_next(&d, &in)) {
+			corpus_measure(&g, &in, v);
+			corpus_put(&w, &in, v);
+		}
+	}
+	free(ee);
+	if (corpus_finish(&w))
+		return created(errno, argv[optind]);
+	printf("%d recordings, %lu ticks to %s\n", files, ticks, argv[optind]);
+	return 0;
+}
+
+static int info(const Corpus *c) {
+	const corpus_header *h = c->h;
+	uint32_t m;
+	printf("%lu replays, %lu ticks, %.1f MB\n", (unsigned long) h->replays,
+		(unsigned long) h->ticks, c->size / 1e6);
+	printf("%-12s %10s %5s\n", "column", "offset", "width");
+	printf("%-12s %10lu %5d\n", "seed", (unsigned long) h->seed, 2);
+	printf("%-12s %10lu %5d\n", "flags", (unsigned long) h->flags, 1);
+	printf("%-12s %10lu %5d\n", "start", (unsigned long) h->start, 8);
+	printf("%-12s %10lu %5d\n", "held", (unsigned long) h->held, 1);
+	printf("%-12s %10lu %5d\n", "pressed", (unsigned long) h->pressed, 1);
+	printf("%-12s %10lu %5d\n", "turn", (unsigned long) h->turn, 1);
+	for (m = 0; m < h->metrics; m++)
+		printf("%-12.16s %10lu %5u\n", h->metric[m].name,
+			(unsigned long) h->metric[m].offset, h->metric[m].width);
+	return 0;
+}
+
+/*
+ * Sum and max of a column, read in place.
+ */
+static void sum_column(const void *col, uint32_t width, uint64_t n,
+		double *sum, uint32_t *max) {
+	uint64_t i, s = 0;
+	uint32_t hi = 0, v;
+	for (i = 0; i < n; i++) {
+		if (width == 1)
+			v = ((const uint8_t *) col)[i];
+		else if (width == 2)
+			v = ((const uint16_t *) col)[i];
+		else
+			v = ((const uint32_t *) col)[i];
+		s += v;
+		if (v > hi)
+			hi = v;
+	}
+	*sum = s;
+	*max = hi;
+}
+
+static int scan(const Corpus *c) {
+	const corpus_header *h = c->h;
+	uint64_t n = h->ticks, i, fire = 0, thrust = 0, longest = 0, r;
+	double t0 = now(), s;
+	uint32_t m;
+
+	for (i = 0; i < n; i++) {
+		fire += (c->pressed[i] & INPUT_FIRE) != 0;
+		thrust += (c->held[i] & INPUT_THRUST) != 0;
+	}
+	for (r = 0; r < h->replays; r++)
+		if (corpus_ticks(c, r) > longest)
+			longest = corpus_ticks(c, r);
+	printf("%lu replays, %lu ticks, longest %lu\n", (unsigned long) h->replays,
+		(unsigned long) n, (unsigned long) longest);
+	printf("fire %.2f%% of ticks, thrust %.2f%%\n", n ? 100.0 * fire / n : 0,
+		n ? 100.0 * thrust / n : 0);
+	if (h->metrics)
+		printf("%-12s %10s %8s\n", "metric", "mean", "max");
+	for (m = 0; m < h->metrics; m++) {
+		double sum;
+		uint32_t max;
+		sum_column(corpus_column_of(c, m), h->metric[m].width, n, &sum, &max);
+		printf("%-12.16s %10.2f %8u\n", h->metric[m].name, n ? sum / n : 0,
+			max);
+	}
+	s = now() - t0;
+	printf("scanned %.1f MB in %.3fs\n", c->size / 1e6, s);
+	return 0;
+}
+
+static int show(const Corpus *c, int argc, char **argv) {
+	uint64_t r, t, count, end;
+	uint32_t m;
+
+	if (argc < 1 || argc > 3)
+		return -1;
+	r = strtoull(argv[0], NULL, 0);
+	t = argc > 1 ? strtoull(argv[1], NULL, 0) : 0;
+	count = argc > 2 ? strtoull(argv[2], NULL, 0) : 20;
+	if (r >= c->h->replays) {
+		fprintf(stderr, "only %lu replays\n", (unsigned long) c->h->replays);
+		return 1;
+	}
+	end = corpus_ticks(c, r);
+	printf("replay %lu: seed %u, %lu ticks%s\n", (unsigned long) r, c->seed[r],
+		(unsigned long) end, c->flags[r] & REPLAY_STRESS ? ", stress" : "");
+	printf("%8s %4s %7s %4s", "tick", "held", "pressed", "turn");
+	for (m = 0; m < c->h->metrics; m++)
+		printf(" %9.16s", c->h->metric[m].name);
+	printf("\n");
+	for (; t < end && count--; t++) {
+		GameInput in;
+		corpus_input(c, r, t, &in);
+		printf("%8lu   %02x      %02x %4d", (unsigned long) t, in.held,
+			in.pressed, in.turn);
+		for (m = 0; m < c->h->metrics; m++)
+			printf(" %9u", corpus_value(c, m, r, t));
+		printf("\n");
+	}
+	return 0;
+}
+
+static int verify(const Corpus *c) {
+	const corpus_header *h = c->h;
+	int lookup[CORPUS_GAME_METRICS], m;
+	uint64_t r, t, bad = 0;
+	uint32_t hash = 2166136261u;
+	double t0 = now(), s;
+	static Game g;
+
+	for (m = 0; m < CORPUS_GAME_METRICS; m++)
+		lookup[m] = corpus_metric(c, corpus_game_names[m]);
+	for (r = 0; r < h->replays; r++) {
+		uint64_t end = corpus_ticks(c, r);
+		start(&g, c->seed[r], c->flags[r]);
+		for (t = 0; t < end; t++) {
+			uint32_t v[CORPUS_GAME_METRICS];
+			GameInput in;
+			corpus_input(c, r, t, &in);
+			corpus_measure(&g, &in, v);
+			for (m = 0; m < CORPUS_GAME_METRICS; m++) {
+				if (lookup[m] >= 0 && corpus_value(c, lookup[m], r, t) != v[m]) {
+					if (!bad++)
+						printf("replay %lu tick %lu: %s is %u, stored %u\n",
+							(unsigned long) r, (unsigned long) t,
+							corpus_game_names[m], v[m],
+							corpus_value(c, lookup[m], r, t));
+				}
+			}
+		}
+		hash = (hash ^ game_hash(&g)) * 16777619u;
+	}
+	s = now() - t0;
+	printf("replayed %lu ticks in %.2fs (%.2f Mticks/s), %lu mismatches\n",
+		(unsigned long) h->ticks, s, h->ticks / s / 1e6, (unsigned long) bad);
+	printf("state %08x\n", hash);
+	return bad != 0;
+}
+
+static void usage(const char *me) {
+	fprintf(stderr, "usage: %s gen [-g games] [-t ticks] [-s first-seed] "
+		"[-p policy] [-m] out\n"
+		"       %s convert [-m] out eeprom.bin...\n"
+		"       %s info|scan|verify file\n"
+		"       %s show file replay [tick [count]]\n", me, me, me, me);
+}
+
+int main(int argc, char **argv) {
+	Corpus c;
+	int ret;
+
+	if (argc < 2) {
+		usage(argv[0]);
+		return 1;
+	}
+	if (!strcmp(argv[1], "gen") || !strcmp(argv[1], "convert")) {
+		ret = argv[1][0] == 'g' ? gen(argc - 1, argv + 1)
+			: convert(argc - 1, argv + 1);
+		if (ret < 0)
+			usage(argv[0]);
+		return ret != 0;
+	}
+	if (argc < 3) {
+		usage(argv[0]);
+		return 1;
+	}
+	if (corpus_open(&c, argv[2])) {
+		perror(argv[2]);
+		return 1;
+	}
+	if (!strcmp(argv[1], "info"))
+		ret = info(&c);
+	else if (!strcmp(argv[1], "scan"))
+		ret = scan(&c);
+	else if (!strcmp(argv[1], "show"))
+		ret = show(&c, argc - 3, argv + 3);
+	else if (!strcmp(argv[1], "verify"))
+		ret = verify(&c);
+	else
+		ret = -1;
+	corpus_close(&c);
+	if (ret < 0)
+		usage(argv[0]);
+	return ret != 0;
+}
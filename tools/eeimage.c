@@ -0,0 +1,91 @@
+#include "eeimage.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Reads a dump into ee. A short dump leaves the rest erased (0xFF).
+ */
+int ee_load(const char *path, uint8_t *ee) {
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return -1;
+	memset(ee, 0xFF, EE_SIZE);
+	if (fread(ee, 1, EE_SIZE, f) == 0 && ferror(f)) {
+		fclose(f);
+		return -1;
+	}
+	return fclose(f);
+}
+
+int ee_save(const char *path, const uint8_t *ee) {
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return -1;
+	if (fwrite(ee, 1, EE_SIZE, f) != EE_SIZE) {
+		fclose(f);
+		return -1;
+	}
+	return fclose(f);
+}
+
+/*
+ * Copies out the replay header. Returns -1 if there is no recording.
+ */
+int ee_header(const uint8_t *ee, replay_header *h) {
+	memcpy(h, ee + REPLAY_ADDR, sizeof(*h));
+	if (h->magic != REPLAY_MAGIC || h->version != REPLAY_VERSION)
+		return -1;
+	return 0;
+}
+
+static void put_header(EeRecorder *r, uint16_t ticks, uint16_t score) {
+	replay_header *h = (replay_header *) (r->ee + REPLAY_ADDR);
+	h->ticks = ticks;
+	h->score = score;
+}
+
+void ee_record_start(EeRecorder *r, uint8_t *ee, uint16_t seed,
+		uint8_t flags) {
+	replay_header *h = (replay_header *) (ee + REPLAY_ADDR);
+	r->ee = ee;
+	r->pos = REPLAY_ADDR + sizeof(*h);
+	r->ticks = 0;
+	r->on = 1;
+	replay_enc_init(&r->enc);
+	h->magic = REPLAY_MAGIC;
+	h->version = REPLAY_VERSION;
+	h->flags = flags;
+	h->seed = seed;
+	put_header(r, REPLAY_UNKNOWN, REPLAY_UNKNOWN);
+	ee[r->pos] = REPLAY_END_CODE;
+}
+
+/*
+ * Records the input for g's next step. Returns 0 once the area is full,
+ * at the same tick record_tick() would stop.
+ */
+uint8_t ee_record_tick(EeRecorder *r, const Game *g, const GameInput *in) {
+	uint8_t out[3], n, i;
+	if (!r->on)
+		return 0;
+	if (r->pos + sizeof(out) + 1 >= REPLAY_END) {
+		ee_record_stop(r, g);
+		return 0;
+	}
+	n = replay_encode(&r->enc, in, out);
+	for (i = 0; i < n; i++)
+		r->ee[r->pos++] = out[i];
+	r->ee[r->pos] = REPLAY_END_CODE;
+	r->ticks++;
+	return 1;
+}
+
+void ee_record_stop(EeRecorder *r, const Game *g) {
+	if (!r->on)
+		return;
+	r->pos += replay_flush(&r->enc, r->ee + r->pos);
+	r->ee[r->pos] = REPLAY_END_CODE;
+	put_header(r, r->ticks, g->score);
+	r->on = 0;
+}
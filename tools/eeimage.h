@@ -0,0 +1,32 @@
+/*
+ * EEPROM images on the host: raw 4KB dumps as dfu-programmer dump-eeprom
+ * writes them, and recording a replay into one the way recorder.c does on
+ * the device.
+ */
+
+#ifndef EEIMAGE_H
+#define EEIMAGE_H
+
+#include "game.h"
+#include "replay.h"
+
+#define EE_SIZE 4096
+
+typedef struct {
+	uint8_t *ee;
+	uint16_t pos;
+	uint16_t ticks;
+	uint8_t on;
+	ReplayEnc enc;
+} EeRecorder;
+
+int ee_load(const char *path, uint8_t *ee);
+int ee_save(const char *path, const uint8_t *ee);
+int ee_header(const uint8_t *ee, replay_header *h);
+
+void ee_record_start(EeRecorder *r, uint8_t *ee, uint16_t seed,
+	uint8_t flags);
+uint8_t ee_record_tick(EeRecorder *r, const Game *g, const GameInput *in);
+void ee_record_stop(EeRecorder *r, const Game *g);
+
+#endif
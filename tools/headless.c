@@ -0,0 +1,117 @@
+/*
+ * Runs the game core (game.c) with no display, as fast as the host allows,
+ * under one of the input policies in policy.c.
+ *
+ *   headless [-n ticks] [-s seed] [-p random|scripted|autopilot|stress]
+ *            [-r policy-seed] [-w eeprom.bin]
+ *
+ * Prints the rate, what the game did and a hash of the final state; two
+ * runs with the same seeds must print the same hash. -w records the run
+ * into an EEPROM image as the device would, until the replay area fills,
+ * for replayer to play back.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "eeimage.h"
+#include "game.h"
+#include "policy.h"
+
+int main(int argc, char **argv) {
+	static Game g;
+	Policy p;
+	int kind = POLICY_RANDOM;
+	unsigned long ticks = 10000000, t;
+	unsigned long deaths = 0, hits = 0, peak_asteroids = 0;
+	uint16_t seed = 1;
+	uint32_t policy = 0, hash;
+	struct timespec t0, t1;
+	const char *image = NULL;
+	static uint8_t ee[EE_SIZE];
+	EeRecorder rec;
+	uint32_t rec_hash = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:s:p:r:w:")) != -1) {
+		switch (opt) {
+		case 'n':
+			ticks = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'p':
+			kind = policy_parse(optarg);
+			if (kind < 0) {
+				fprintf(stderr, "unknown policy %s\n", optarg);
+				return 1;
+			}
+			break;
+		case 'r':
+			policy = strtoul(optarg, NULL, 0);
+			break;
+		case 'w':
+			image = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n ticks] [-s seed] "
+				"[-p random|scripted|autopilot|stress] [-r policy-seed] "
+				"[-w eeprom.bin]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	game_init(&g, seed);
+	policy_init(&p, kind, policy);
+	g.stress = kind == POLICY_STRESS;
+	memset(ee, 0xFF, sizeof(ee));
+	if (image)
+		ee_record_start(&rec, ee, seed, g.stress ? REPLAY_STRESS : 0);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (t = 0; t < ticks; t++) {
+		uint8_t alive = g.ship.state != DEAD;
+		uint16_t score = g.score;
+		const GameInput *in = policy_next(&p, &g);
+		uint8_t n;
+
+		if (image && rec.on && !ee_record_tick(&rec, &g, in))
+			rec_hash = game_hash(&g);
+		game_step(&g, in);
+
+		if (alive && g.ship.state == DEAD)
+			deaths++;
+		if (g.score > score)
+			hits += g.score - score;
+		n = game_asteroids(&g);
+		if (n > peak_asteroids)
+			peak_asteroids = n;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	double s = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	hash = game_hash(&g);
+
+	printf("ticks %lu in %.3fs: %.2f Mticks/s (%.0fx real time)\n", ticks, s,
+		ticks / s / 1e6, ticks * 0.05 / s);
+	printf("hits %lu, deaths %lu, peak asteroids %lu, score %u\n", hits,
+		deaths, peak_asteroids, g.score);
+	printf("state %08x\n", hash);
+
+	if (image) {
+		if (rec.on) {
+			ee_record_stop(&rec, &g);
+			rec_hash = hash;
+		}
+		if (ee_save(image, ee)) {
+			perror(image);
+			return 1;
+		}
+		printf("recorded %u ticks in %u bytes to %s, state %08x\n",
+			rec.ticks, rec.pos - REPLAY_ADDR, image, rec_hash);
+	}
+	return 0;
+}
@@ -0,0 +1,196 @@
+#include "ili9341.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ili934x.h"
+
+#define MADCTL_MY 0x80
+#define MADCTL_MX 0x40
+#define MADCTL_MV 0x20
+
+ili9341_stats ili9341_count;
+
+static uint16_t gram[ILI_ROWS][ILI_COLS];
+static uint8_t madctl;
+static uint16_t sc, ec, sp, ep; // Column and page window.
+static uint16_t col, page;      // Write pointer.
+static uint8_t cmd;             // Command the data bytes belong to.
+static uint8_t nparam;          // Data bytes since the command.
+static uint8_t param[4];
+static uint8_t high;            // First byte of a pixel.
+
+void ili9341_reset() {
+	memset(gram, 0, sizeof(gram));
+	madctl = 0;
+	sc = sp = 0;
+	ec = ILI_COLS - 1;
+	ep = ILI_ROWS - 1;
+	col = page = 0;
+	cmd = NO_OPERATION;
+	nparam = 0;
+	ili9341_clear_stats();
+}
+
+void ili9341_clear_stats() {
+	memset(&ili9341_count, 0, sizeof(ili9341_count));
+}
+
+unsigned long ili9341_bus_cycles() {
+	return (ili9341_count.cmds + ili9341_count.data) * ILI_CYCLES_PER_WRITE;
+}
+
+/*
+ * Frame memory cell for a column/page address under the current MADCTL.
+ * Returns NULL outside the panel.
+ */
+static uint16_t *cell(uint16_t c, uint16_t p) {
+	uint16_t x = c, y = p;
+	if (madctl & MADCTL_MV) {
+		x = p;
+		y = c;
+	}
+	if (x >= ILI_COLS || y >= ILI_ROWS)
+		return NULL;
+	if (madctl & MADCTL_MX)
+		x = ILI_COLS - 1 - x;
+	if (madctl & MADCTL_MY)
+		y = ILI_ROWS - 1 - y;
+	return &gram[y][x];
+}
+
+/*
+ * Pixels fill the window along the column first, then the page, wrapping
+ * to the top when the window is full.
+ */
+static void write_pixel(uint16_t rgb) {
+	uint16_t *p = cell(col, page);
+	if (p) {
+		*p = rgb;
+		ili9341_count.pixels++;
+	} else {
+		ili9341_count.clipped++;
+	}
+	if (++col > ec) {
+		col = sc;
+		if (++page > ep)
+			page = sp;
+	}
+}
+
+void ili9341_cmd(uint8_t c) {
+	ili9341_count.cmds++;
+	cmd = c;
+	nparam = 0;
+	switch (c) {
+	case COLUMN_ADDRESS_SET:
+	case PAGE_ADDRESS_SET:
+		ili9341_count.windows++;
+		break;
+	case MEMORY_WRITE:
+		col = sc;
+		page = sp;
+		/* fall through */
+	case WRITE_MEMORY_CONTINUE:
+		high = 0;
+		break;
+	case SOFTWARE_RESET:
+		ili9341_reset();
+		ili9341_count.cmds = 1;
+		break;
+	}
+}
+
+void ili9341_data(uint8_t d) {
+	ili9341_count.data++;
+	switch (cmd) {
+	case MEMORY_WRITE:
+	case WRITE_MEMORY_CONTINUE:
+		if (nparam++ & 1)
+			write_pixel(high << 8 | d);
+		else
+			high = d;
+		return;
+	case MEMORY_ACCESS_CONTROL:
+		if (nparam++ == 0)
+			madctl = d;
+		return;
+	case COLUMN_ADDRESS_SET:
+	case PAGE_ADDRESS_SET:
+		if (nparam < 4)
+			param[nparam] = d;
+		if (++nparam == 4) {
+			uint16_t s = param[0] << 8 | param[1];
+			uint16_t e = param[2] << 8 | param[3];
+			if (cmd == COLUMN_ADDRESS_SET) {
+				sc = s;
+				ec = e;
+			} else {
+				sp = s;
+				ep = e;
+			}
+		}
+		return;
+	default:
+		nparam++;
+	}
+}
+
+void ili9341_data16(uint16_t d) {
+	ili9341_data(d >> 8);
+	ili9341_data(d);
+}
+
+/*
+ * Logical size of the picture under the current MADCTL.
+ */
+static void view_size(uint16_t *w, uint16_t *h) {
+	*w = (madctl & MADCTL_MV) ? ILI_ROWS : ILI_COLS;
+	*h = (madctl & MADCTL_MV) ? ILI_COLS : ILI_ROWS;
+}
+
+/*
+ * Pixel at (x, y) as the drawing code addresses it under the current
+ * MADCTL.
+ */
+uint16_t ili9341_pixel(uint16_t x, uint16_t y) {
+	uint16_t *p = cell(x, y);
+	return p ? *p : 0;
+}
+
+/*
+ * FNV-1a over the frame memory, for comparing frames in regression runs.
+ */
+uint32_t ili9341_checksum() {
+	const uint8_t *b = (const uint8_t *) gram;
+	uint32_t h = 2166136261u;
+	size_t i;
+	for (i = 0; i < sizeof(gram); i++)
+		h = (h ^ b[i]) * 16777619u;
+	return h;
+}
+
+/*
+ * Writes the picture as a binary PPM, the right way up for the current
+ * orientation.
+ */
+int ili9341_dump_ppm(const char *path) {
+	uint16_t w, h, x, y;
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return -1;
+	view_size(&w, &h);
+	fprintf(f, "P6\n%u %u\n255\n", w, h);
+	for (y = 0; y < h; y++) {
+		for (x = 0; x < w; x++) {
+			uint16_t p = ili9341_pixel(x, y);
+			uint8_t rgb[3] = {
+				(p >> 11) << 3 | (p >> 13),
+				((p >> 5) & 0x3F) << 2 | ((p >> 9) & 0x03),
+				(p & 0x1F) << 3 | ((p >> 2) & 0x07)
+			};
+			fwrite(rgb, 1, 3, f);
+		}
+	}
+	return fclose(f);
+}
@@ -0,0 +1,39 @@
+/*
+ * Software model of the ILI9341 as the LaFortuna drives it: 16-bit pixels
+ * over an 8-bit bus. Implements CASET/PASET/RAMWR/RAMWRC and MADCTL into a
+ * 240x320 RGB565 frame memory and counts the bus traffic. lcd.c talks to it
+ * through the write_* macros in ili934x.h when built with -DHOST.
+ */
+
+#ifndef ILI9341_H
+#define ILI9341_H
+
+#include <stdint.h>
+
+#define ILI_COLS 240
+#define ILI_ROWS 320
+/* An sts to the XMEM interface with no wait states. */
+#define ILI_CYCLES_PER_WRITE 3
+
+typedef struct {
+	unsigned long cmds;
+	unsigned long data;       // Data bytes, including command parameters.
+	unsigned long pixels;     // Pixels written to frame memory.
+	unsigned long clipped;    // Pixels that fell outside it.
+	unsigned long windows;    // CASET + PASET commands.
+} ili9341_stats;
+
+extern ili9341_stats ili9341_count;
+
+void ili9341_reset();
+void ili9341_cmd(uint8_t cmd);
+void ili9341_data(uint8_t data);
+void ili9341_data16(uint16_t data);
+
+unsigned long ili9341_bus_cycles();
+void ili9341_clear_stats();
+uint16_t ili9341_pixel(uint16_t x, uint16_t y);
+uint32_t ili9341_checksum();
+int ili9341_dump_ppm(const char *path);
+
+#endif
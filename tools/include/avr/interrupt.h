@@ -0,0 +1,10 @@
+/* Host stand-in for <avr/interrupt.h>. Vectors become ordinary functions. */
+
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#define ISR(vector, ...) void vector(void)
+#define sei()
+#define cli()
+
+#endif
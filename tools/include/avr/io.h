@@ -0,0 +1,35 @@
+/*
+ * Host stand-in for <avr/io.h>: the registers the firmware sources touch,
+ * as plain variables (defined in tools/avrstub.c), so lcd.c and friends
+ * compile and run on Linux. Writes have no effect beyond the variable.
+ */
+
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+#define _BV(b) (1 << (b))
+
+#define HOST_REGS(X) \
+	X(DDRB) X(DDRC) X(DDRE) X(PORTB) X(PORTC) X(PORTE) X(PINC) X(PINE) \
+	X(XMCRA) X(XMCRB) X(EICRB) X(EIMSK) X(EIFR) \
+	X(TCCR2A) X(TCCR2B) X(OCR2A) X(SREG) X(GPIOR0)
+
+#define HOST_REG_DECL(r) extern volatile uint8_t r;
+HOST_REGS(HOST_REG_DECL)
+
+/* Bits */
+#define XMM1    1
+#define XMM2    2
+#define SRE     7
+#define ISC61   5
+#define COM2A1  7
+#define WGM20   0
+#define WGM21   1
+#define CS20    0
+
+#define RAMSTART 0x100
+#define RAMEND   0x20FF
+
+#endif
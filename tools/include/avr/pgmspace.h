@@ -0,0 +1,14 @@
+/* Host stand-in for <avr/pgmspace.h>: flash is ordinary memory. */
+
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *) (p))
+#define pgm_read_word(p) (*(const uint16_t *) (p))
+
+#endif
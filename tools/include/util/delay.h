@@ -0,0 +1,9 @@
+/* Host stand-in for <util/delay.h>: delays take no time. */
+
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+#define _delay_ms(ms) ((void) (ms))
+#define _delay_us(us) ((void) (us))
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * Runs the lcd.c primitives against the ILI9341 model and reports the bus
+ * traffic each one generates: commands, data bytes and the AVR cycles the
+ * XMEM writes alone take at ILI_CYCLES_PER_WRITE each. The final picture is
+ * written as a PPM so regressions in the drawing code can be seen.
+ *
+ * usage: lcdbench [-o out.ppm]
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "ili9341.h"
+#include "lcd.h"
+#include "ship.h"
+#include "splash.h"
+
+#undef printf
+
+#define CPU_HZ 8000000UL
+
+static void report(const char *name, unsigned long calls) {
+	unsigned long cycles = ili9341_bus_cycles();
+	printf("%-24s %6lu %8lu %9lu %9lu %9.1f %8.2f\n", name,
+	       ili9341_count.cmds / calls, ili9341_count.data / calls,
+	       ili9341_count.pixels / calls, cycles / calls,
+	       (double) cycles / calls * 1e6 / CPU_HZ,
+	       ili9341_count.pixels ? (double) cycles / ili9341_count.pixels : 0.0);
+	ili9341_clear_stats();
+}
+
+int main(int argc, char **argv) {
+	const char *out = "lcdbench.ppm";
+	int opt, i;
+
+	while ((opt = getopt(argc, argv, "o:")) != -1) {
+		switch (opt) {
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-o out.ppm]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	ili9341_reset();
+	printf("%-24s %6s %8s %9s %9s %9s %8s\n", "primitive", "cmds", "bytes",
+	       "pixels", "cycles", "us", "cyc/px");
+
+	init_lcd();
+	report("init_lcd", 1);
+
+	clear_screen();
+	report("clear_screen", 1);
+
+	display_image(splash, 0, 0);
+	report("display_image splash", 1);
+
+	for (i = 0; i < SHIP_SPRITES_FRAMES; i++)
+		display_sprite(ship_sprites + pgm_read_word(&ship_sprites_frames[i]),
+			160, 120, NULL);
+	report("display_sprite ship", SHIP_SPRITES_FRAMES);
+
+	for (i = 0; i < 16; i++) {
+		rectangle r = {10 + i, 10 + i + 3, 10, 10 + 3};
+		fill_rectangle(r, RED);
+	}
+	report("fill_rectangle 4x4", 16);
+
+	for (i = 0; i < 16; i++) {
+		rectangle r = {40, 40 + 39, 30, 30 + 39};
+		fill_rectangle(r, GREEN);
+	}
+	report("fill_rectangle 40x40", 16);
+
+	for (i = 0; i < 16; i++)
+		draw_outline_rectangle(100 + i, 30, 20, 20, YELLOW);
+	report("draw_outline_rectangle", 16);
+
+	for (i = 0; i < 64; i++)
+		draw_pixel(10 + i, 100, WHITE);
+	report("draw_pixel", 64);
+
+	for (i = 0; i < 16; i++)
+		draw_line(160, 120, 160 + 60, 120 + 4 * i, CYAN);
+	report("draw_line 60px", 16);
+
+	display_string_xy("LaFortuna", 10, 200);
+	report("display_string 9 chars", 9);
+
+	display_thing_xy(10, 220, "Score: %d", 1234);
+	report("display_thing_xy", 1);
+
+	display_string_scaled_xy("x3", 200, 190, 3);
+	report("display_string x3 2 chars", 2);
+
+	if (ili9341_dump_ppm(out)) {
+		perror(out);
+		return 1;
+	}
+	printf("frame checksum %08x -> %s\n", ili9341_checksum(), out);
+	return 0;
+}
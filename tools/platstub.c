@@ -0,0 +1,10 @@
+/*
+ * Platform hooks render.c calls on the board, as no-ops for host builds.
+ */
+
+#include <stdint.h>
+#include "latency.h"
+
+void latency_photon(uint8_t kind) {
+	(void) kind;
+}
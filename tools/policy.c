@@ -0,0 +1,89 @@
+#include "policy.h"
+#include "autopilot.h"
+
+#include <string.h>
+
+static uint32_t xorshift(uint32_t *s) {
+	*s ^= *s << 13;
+	*s ^= *s >> 17;
+	*s ^= *s << 5;
+	return *s;
+}
+
+void policy_init(Policy *p, uint8_t kind, uint32_t seed) {
+	memset(p, 0, sizeof(*p));
+	p->kind = kind;
+	p->rng = seed ? seed : 0x2545F491;
+}
+
+/*
+ * Holds each direction for a random stretch of ticks and fires about one
+ * tick in eight.
+ */
+static void random_input(Policy *p) {
+	GameInput *in = &p->in;
+	uint32_t r = xorshift(&p->rng);
+
+	in->pressed = 0;
+	if (p->hold == 0) {
+		uint8_t held = r & (INPUT_THRUST | INPUT_LEFT | INPUT_RIGHT);
+		in->pressed = held & ~in->held;
+		in->held = held;
+		p->hold = (r >> 8) & 15;
+	} else {
+		p->hold--;
+	}
+	if ((r >> 16 & 7) == 0)
+		in->pressed |= INPUT_FIRE;
+	in->turn = 0;
+}
+
+/*
+ * Turns right all the time, fires every fourth tick and thrusts for one
+ * second in every eight, so the ship sweeps the field the same way in
+ * every game.
+ */
+static void scripted_input(Policy *p) {
+	GameInput *in = &p->in;
+	uint8_t held = INPUT_RIGHT;
+
+	if (p->tick % 160 < 20)
+		held |= INPUT_THRUST;
+	in->pressed = held & ~in->held;
+	if (p->tick % 4 == 0)
+		in->pressed |= INPUT_FIRE;
+	in->held = held;
+	in->turn = 0;
+}
+
+/*
+ * The next tick's input. The autopilot policies look at the game g; the
+ * caller turns on g->stress for POLICY_STRESS.
+ */
+const GameInput *policy_next(Policy *p, const Game *g) {
+	if (p->kind == POLICY_SCRIPTED)
+		scripted_input(p);
+	else if (p->kind >= POLICY_AUTOPILOT)
+		autopilot(g, &p->in, p->kind == POLICY_STRESS);
+	else
+		random_input(p);
+	p->tick++;
+	return &p->in;
+}
+
+static const char *names[] = { "random", "scripted", "autopilot", "stress" };
+
+/*
+ * Policy number for a name given on a command line, or -1.
+ */
+int policy_parse(const char *name) {
+	int kind;
+	for (kind = 0; kind < (int) (sizeof(names) / sizeof(names[0])); kind++)
+		if (!strcmp(name, names[kind]))
+			return kind;
+	return -1;
+}
+
+const char *policy_name(uint8_t kind) {
+	return names[kind];
+}
@@ -0,0 +1,28 @@
+/*
+ * Input policies for driving the game core without a player.
+ */
+
+#ifndef POLICY_H
+#define POLICY_H
+
+#include "game.h"
+
+#define POLICY_RANDOM   0 // Mash the pad: random holds, fire now and then.
+#define POLICY_SCRIPTED 1 // Circle and fire on a fixed pattern.
+#define POLICY_AUTOPILOT 2 // The attract mode's autopilot.
+#define POLICY_STRESS   3 // The autopilot with the game's stress setting on.
+
+typedef struct {
+	uint8_t kind;
+	uint32_t rng;
+	uint8_t hold;
+	uint16_t tick;
+	GameInput in;
+} Policy;
+
+void policy_init(Policy *p, uint8_t kind, uint32_t seed);
+const GameInput *policy_next(Policy *p, const Game *g);
+int policy_parse(const char *name);
+const char *policy_name(uint8_t kind);
+
+#endif
@@ -0,0 +1,27 @@
+#!/bin/sh
+#
+# Static RAM breakdown for an AVR ELF: per object file, then the largest
+# symbols, then what is left for the stack.
+#
+# Usage: ramreport.sh <ram size> <elf> <object files...>
+
+RAMSIZE=$1
+ELF=$2
+shift 2
+
+echo "== Static RAM by module (.data + .bss) =="
+for o in "$@"; do
+	avr-nm -S -t d "$o" | awk -v f="$(basename "$o" .o)" '
+		NF == 4 && $3 ~ /^[bBdDC]$/ { s += $2 }
+		END { printf "%6d  %s\n", s, f }'
+done | sort -rn
+
+echo
+echo "== Largest symbols =="
+avr-nm -S -t d --size-sort -r "$ELF" | awk '
+	NF == 4 && $3 ~ /^[bBdD]$/ && n++ < 15 { printf "%6d  %s\n", $2, $4 }'
+
+echo
+avr-size -A "$ELF" | awk -v ram="$RAMSIZE" '
+	$1 == ".data" || $1 == ".bss" || $1 == ".noinit" { s += $2 }
+	END { printf "Static: %d bytes, left for stack: %d of %d\n", s, ram - s, ram }'
@@ -0,0 +1,141 @@
+/*
+ * Plays back a game recorded into EEPROM, from a dump of it, through
+ * game.c and render.c on the ILI9341 model.
+ *
+ *   replayer [-b budget] [-f tick] [-o frame.ppm] eeprom.bin
+ *
+ * Prints the LCD traffic per frame, the worst frame and a hash of the
+ * final state, and checks the score against the one the device wrote when
+ * it last synced. -o dumps the frame at tick -f, by default the worst.
+ * Get the dump with 'dfu-programmer at90usb1286 dump-eeprom > eeprom.bin'.
+ *
+ * The device's libm is not glibc, so a long host playback can drift from
+ * what the device showed; playback on the device itself is exact.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "eeimage.h"
+#include "game.h"
+#include "ili9341.h"
+#include "lcd.h"
+#include "render.h"
+
+#undef printf
+
+static uint8_t ee[EE_SIZE];
+
+static uint8_t ee_read(uint16_t addr) {
+	return ee[addr];
+}
+
+typedef struct {
+	unsigned long ticks;
+	unsigned long cmds, bytes;
+	unsigned long worst, worst_tick;
+	uint16_t score_at_sync;
+	uint32_t hash;
+} Playback;
+
+/*
+ * Plays the whole recording, dumping the frame at tick `shot` to `ppm` if
+ * it is given.
+ */
+static void play(const replay_header *h, uint16_t budget, unsigned long shot,
+		const char *ppm, Playback *p) {
+	static Game g;
+	ReplayDec dec;
+	GameInput in;
+
+	ili9341_reset();
+	init_lcd();
+	render_reset();
+	render_budget = budget;
+	game_init(&g, h->seed);
+	g.stress = h->flags & REPLAY_STRESS;
+	g.state = PLAY_STATE;
+	replay_dec_init(&dec, ee_read);
+	p->ticks = p->cmds = p->bytes = p->worst = p->worst_tick = 0;
+	p->score_at_sync = REPLAY_UNKNOWN;
+
+	while (replay_next(&dec, &in)) {
+		if (p->ticks == h->ticks)
+			p->score_at_sync = g.score;
+		game_step(&g, &in);
+		ili9341_clear_stats();
+		render(&g);
+		p->cmds += ili9341_count.cmds;
+		p->bytes += ili9341_count.data;
+		if (ili9341_count.data > p->worst) {
+			p->worst = ili9341_count.data;
+			p->worst_tick = p->ticks;
+		}
+		if (ppm && p->ticks == shot && ili9341_dump_ppm(ppm))
+			perror(ppm);
+		p->ticks++;
+	}
+	if (p->ticks == h->ticks)
+		p->score_at_sync = g.score;
+	p->hash = game_hash(&g);
+}
+
+int main(int argc, char **argv) {
+	const char *ppm = NULL;
+	unsigned long shot = ~0UL;
+	uint16_t budget = BUDGET_MAX;
+	replay_header h;
+	Playback p;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "b:f:o:")) != -1) {
+		switch (opt) {
+		case 'b':
+			budget = strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			shot = strtoul(optarg, NULL, 0);
+			break;
+		case 'o':
+			ppm = optarg;
+			break;
+		default:
+			optind = argc;
+			break;
+		}
+	}
+	if (optind != argc - 1) {
+		fprintf(stderr, "usage: %s [-b budget] [-f tick] [-o frame.ppm] "
+			"eeprom.bin\n", argv[0]);
+		return 1;
+	}
+	if (ee_load(argv[optind], ee)) {
+		perror(argv[optind]);
+		return 1;
+	}
+	if (ee_header(ee, &h)) {
+		fprintf(stderr, "%s: no recording in it\n", argv[optind]);
+		return 1;
+	}
+
+	play(&h, budget, shot, NULL, &p);
+	if (ppm)
+		play(&h, budget, shot == ~0UL ? p.worst_tick : shot, ppm, &p);
+
+	printf("seed %u%s, %lu ticks (%.1fs)\n", h.seed,
+		h.flags & REPLAY_STRESS ? ", stress" : "", p.ticks, p.ticks * 0.05);
+	if (p.ticks)
+		printf("per frame %.1f cmds, %.1f bytes; worst %lu bytes at tick %lu\n",
+			(double) p.cmds / p.ticks, (double) p.bytes / p.ticks, p.worst,
+			p.worst_tick);
+	if (h.ticks == REPLAY_UNKNOWN)
+		printf("never synced, no score to check against\n");
+	else if (p.score_at_sync != h.score)
+		printf("DIVERGED: score at tick %u is %u, the device had %u\n",
+			h.ticks, p.score_at_sync, h.score);
+	else
+		printf("score at tick %u matches the device: %u\n", h.ticks, h.score);
+	printf("state %08x\n", p.hash);
+	return p.score_at_sync != h.score && h.ticks != REPLAY_UNKNOWN;
+}
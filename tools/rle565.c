@@ -0,0 +1,194 @@
+/*
+ * Converts a binary PPM into the run-length encoded image format lcd.c's
+ * display_image() draws from flash (see lcd/lcd.h), written out as a C
+ * header holding a PROGMEM array.
+ *
+ *   rle565 [-n name] [-o out.h] image.ppm
+ *
+ * Colours are cut to RGB565; the image may use at most IMAGE_COLOURS of
+ * them after that. The size of the result and of the raw image it stands
+ * for go to stderr.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lcd.h"
+
+#undef printf
+
+typedef struct {
+	unsigned w, h;
+	uint16_t *pixels;
+} Image;
+
+typedef struct {
+	uint8_t *data;
+	size_t len, size;
+} Buffer;
+
+static void put(Buffer *b, uint8_t byte) {
+	if (b->len == b->size) {
+		b->size = b->size ? b->size * 2 : 4096;
+		b->data = realloc(b->data, b->size);
+		if (!b->data) {
+			perror("realloc");
+			exit(1);
+		}
+	}
+	b->data[b->len++] = byte;
+}
+
+static void put16(Buffer *b, uint16_t w) {
+	put(b, w & 0xFF);
+	put(b, w >> 8);
+}
+
+/* Skips whitespace and # comments between PPM header fields. */
+static int field(FILE *f, unsigned *v) {
+	int c;
+	while ((c = getc(f)) != EOF) {
+		if (c == '#')
+			while ((c = getc(f)) != EOF && c != '\n')
+				;
+		else if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			break;
+	}
+	if (c == EOF)
+		return -1;
+	ungetc(c, f);
+	return fscanf(f, "%u", v) == 1 ? 0 : -1;
+}
+
+static int read_ppm(const char *path, Image *img) {
+	FILE *f = fopen(path, "rb");
+	unsigned max, i;
+	uint8_t rgb[3];
+
+	if (!f)
+		return -1;
+	if (getc(f) != 'P' || getc(f) != '6' || field(f, &img->w)
+			|| field(f, &img->h) || field(f, &max) || max != 255
+			|| getc(f) == EOF) {
+		fprintf(stderr, "%s: not an 8-bit binary PPM\n", path);
+		fclose(f);
+		return -1;
+	}
+	img->pixels = malloc(sizeof(uint16_t) * img->w * img->h);
+	for (i = 0; i < img->w * img->h; i++) {
+		if (fread(rgb, 3, 1, f) != 1) {
+			fprintf(stderr, "%s: short image\n", path);
+			fclose(f);
+			return -1;
+		}
+		img->pixels[i] = (rgb[0] >> 3) << 11 | (rgb[1] >> 2) << 5 | rgb[2] >> 3;
+	}
+	fclose(f);
+	return 0;
+}
+
+/*
+ * Encodes img into b. Returns the number of runs, or -1 if it has too many
+ * colours.
+ */
+static long encode(const Image *img, Buffer *b) {
+	uint16_t palette[IMAGE_COLOURS];
+	unsigned colours = 0, i, n = img->w * img->h, p = 0;
+	long runs = 0;
+
+	for (i = 0; i < n; i++) {
+		unsigned c;
+		for (c = 0; c < colours && palette[c] != img->pixels[i]; c++)
+			;
+		if (c == colours) {
+			if (colours == IMAGE_COLOURS)
+				return -1;
+			palette[colours++] = img->pixels[i];
+		}
+	}
+
+	put16(b, img->w);
+	put16(b, img->h);
+	put(b, colours);
+	for (i = 0; i < colours; i++)
+		put16(b, palette[i]);
+
+	while (p < n) {
+		unsigned len = 1, c = 0;
+		while (p + len < n && img->pixels[p + len] == img->pixels[p]
+				&& len < 0xFFFF)
+			len++;
+		while (palette[c] != img->pixels[p])
+			c++;
+		if (len <= IMAGE_LONG_RUN) {
+			put(b, (len - 1) << 4 | c);
+		} else {
+			put(b, IMAGE_LONG_RUN << 4 | c);
+			put16(b, len);
+		}
+		p += len;
+		runs++;
+	}
+	return runs;
+}
+
+int main(int argc, char **argv) {
+	const char *name = "image", *out = NULL;
+	Buffer b = { NULL, 0, 0 };
+	Image img;
+	FILE *f = stdout;
+	long runs;
+	size_t i;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:o:")) != -1) {
+		switch (opt) {
+		case 'n':
+			name = optarg;
+			break;
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n name] [-o out.h] image.ppm\n",
+				argv[0]);
+			return 1;
+		}
+	}
+	if (optind != argc - 1) {
+		fprintf(stderr, "usage: %s [-n name] [-o out.h] image.ppm\n", argv[0]);
+		return 1;
+	}
+	if (read_ppm(argv[optind], &img)) {
+		perror(argv[optind]);
+		return 1;
+	}
+	runs = encode(&img, &b);
+	if (runs < 0) {
+		fprintf(stderr, "%s: more than %d colours in RGB565\n", argv[optind],
+			IMAGE_COLOURS);
+		return 1;
+	}
+	if (out && !(f = fopen(out, "w"))) {
+		perror(out);
+		return 1;
+	}
+
+	fprintf(f, "/* %ux%u RLE image from %s, by tools/rle565: %lu bytes, "
+		"%ld runs. */\n\n#include <avr/pgmspace.h>\n\n"
+		"const uint8_t %s[] PROGMEM = {", img.w, img.h, argv[optind],
+		(unsigned long) b.len, runs, name);
+	for (i = 0; i < b.len; i++)
+		fprintf(f, "%s0x%02x,", i % 12 ? " " : "\n\t", b.data[i]);
+	fprintf(f, "\n};\n");
+	if (f != stdout && fclose(f)) {
+		perror(out);
+		return 1;
+	}
+	fprintf(stderr, "%s: %ux%u, %u bytes raw, %lu encoded, %ld runs\n",
+		argv[optind], img.w, img.h, img.w * img.h * 2, (unsigned long) b.len,
+		runs);
+	return 0;
+}
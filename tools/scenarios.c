@@ -0,0 +1,369 @@
+/*
+ * Canned, deterministic game scenarios played through game.c and drawn by
+ * render.c onto the ILI9341 model, for catching performance regressions
+ * in either.
+ *
+ *   scenarios [-r corpus] [-c limits] [-T] [-u limits] [-b budget] [-o dir]
+ *
+ * Prints per-frame LCD commands and data bytes, the worst frame and the
+ * mean game_step time (best of RUNS runs) for each scenario. -r adds each
+ * replay in a corpus as a scenario, worst1 on, such as the cases
+ * worstcase saves. With -c the exit status is 1 if any of them is over
+ * a bus traffic limit, which is the same on any host; step time depends on
+ * the machine, so it is only printed against its limit unless -T makes it
+ * count too. -u writes limits from this run with some headroom, in place
+ * of any the file had for the same scenarios. -o dumps each scenario's
+ * last frame as a PPM.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "corpus.h"
+#include "game.h"
+#include "ili9341.h"
+#include "lcd.h"
+#include "render.h"
+#include "replay.h"
+
+#undef printf
+
+// Headroom -u leaves over this run: bus traffic is exact, time is not.
+#define BUS_HEADROOM 1.05
+#define TIME_HEADROOM 4.0
+#define RUNS 3 // Step time is the best of this many runs.
+#define MAX_SCENARIOS 32
+
+/* A canned scenario, or with no setup, a replay from the corpus. */
+typedef struct {
+	const char *name;
+	uint16_t frames;
+	void (*setup)(Game *g);
+	void (*input)(const Game *g, GameInput *in);
+	uint64_t replay;
+} Scenario;
+
+typedef struct {
+	double cmds;    // Mean commands per frame.
+	double bytes;   // Mean data bytes per frame.
+	double worst;   // Data bytes in the busiest frame.
+	double step_us; // Mean game_step time.
+} Result;
+
+static const char *metrics[] = { "cmds", "bytes", "worst", "step_us" };
+#define NO_METRICS 4
+#define STEP_US 3 // The one metric that depends on the machine.
+
+static void put_asteroid(Game *g, uint8_t i, float x, float y, float x_inc,
+		float y_inc, uint8_t size) {
+	Asteroid *a = &g->asteroids[i];
+	a->origin.x = x;
+	a->origin.y = y;
+	a->x_inc = x_inc;
+	a->y_inc = y_inc;
+	a->size = size;
+	g->asteroid_i = (i + 1) % NO_ASTEROIDS;
+}
+
+/* Nothing spawns while the game thinks the field is full. */
+static void no_spawns(Game *g) {
+	g->pot_asteroids = NO_ASTEROIDS;
+}
+
+static void empty_setup(Game *g) {
+	no_spawns(g);
+}
+
+static void twelve_setup(Game *g) {
+	uint8_t i;
+	no_spawns(g);
+	for (i = 0; i < NO_ASTEROIDS; i++)
+		put_asteroid(g, i, 10 + (i % 4) * 80, 10 + (i / 4) * 80,
+			(i % 3) - 1, (i % 2) ? 2 : -2, BIG_SIZE);
+	g->pot_asteroids = NO_ASTEROIDS * 4;
+}
+
+/* A ring of still asteroids round the ship, for it to shoot to pieces. */
+static void split_setup(Game *g) {
+	static const int8_t ring[][2] = {
+		{ -20, -90 }, { 60, -70 }, { 80, 0 }, { 60, 40 },
+		{ -20, 60 }, { -100, 40 }, { -120, -20 }, { -100, -80 },
+	};
+	uint8_t i;
+	for (i = 0; i < sizeof(ring) / sizeof(ring[0]); i++)
+		put_asteroid(g, i, 160 + ring[i][0], 120 + ring[i][1], 0, 0,
+			BIG_SIZE);
+	g->pot_asteroids = NO_ASTEROIDS * 4;
+}
+
+/* An asteroid on top of a ship whose invincibility has run out. */
+static void death_setup(Game *g) {
+	no_spawns(g);
+	g->ship.state = VINCIBLE;
+	put_asteroid(g, 0, 140, 100, 0.5, 0.5, BIG_SIZE);
+}
+
+static void idle(const Game *g, GameInput *in) {
+	(void) g;
+	in->held = in->pressed = 0;
+	in->turn = 0;
+}
+
+/*
+ * One shot every third tick keeps 4 to 7 bullets in the ring; firing any
+ * faster laps it and empties it.
+ */
+static void spin_and_fire(const Game *g, GameInput *in) {
+	in->held = INPUT_RIGHT;
+	in->pressed = g->tick % 3 ? 0 : INPUT_FIRE;
+	in->turn = 0;
+}
+
+static void sweep_and_fire(const Game *g, GameInput *in) {
+	in->held = INPUT_LEFT;
+	in->pressed = g->tick % 2 ? 0 : INPUT_FIRE;
+	in->turn = 0;
+}
+
+static Scenario scenarios[MAX_SCENARIOS] = {
+	{ "empty", 200, empty_setup, idle, 0 },
+	{ "twelve_big", 200, twelve_setup, idle, 0 },
+	{ "bullet_ring", 200, empty_setup, spin_and_fire, 0 },
+	{ "mass_split", 200, split_setup, sweep_and_fire, 0 },
+	{ "death", 60, death_setup, idle, 0 },
+};
+static unsigned no_scenarios = 5;
+static Corpus corpus;
+
+/*
+ * Adds the replays in a corpus, as many as there is room for.
+ */
+static int add_replays(const char *path) {
+	static char names[MAX_SCENARIOS][16];
+	uint64_t r;
+	if (corpus_open(&corpus, path))
+		return -1;
+	for (r = 0; r < corpus.h->replays && no_scenarios < MAX_SCENARIOS; r++) {
+		Scenario *s = &scenarios[no_scenarios];
+		snprintf(names[no_scenarios], sizeof(names[0]), "worst%u",
+			(unsigned) r + 1);
+		s->name = names[no_scenarios++];
+		s->frames = corpus_ticks(&corpus, r);
+		s->replay = r;
+	}
+	return 0;
+}
+
+static double now_us() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static void play(const Scenario *s, uint16_t budget, const char *dir,
+		Result *r) {
+	static Game g;
+	GameInput in = { 0, 0, 0 };
+	unsigned long cmds = 0, bytes = 0;
+	double step = 0;
+	uint16_t f;
+
+	ili9341_reset();
+	init_lcd();
+	render_reset();
+	render_budget = budget;
+	if (s->setup) {
+		game_init(&g, 1);
+		s->setup(&g);
+	} else {
+		game_init(&g, corpus.seed[s->replay]);
+		g.stress = corpus.flags[s->replay] & REPLAY_STRESS;
+		g.state = PLAY_STATE;
+	}
+	memset(r, 0, sizeof(*r));
+
+	for (f = 0; f < s->frames; f++) {
+		double t0;
+		if (s->setup)
+			s->input(&g, &in);
+		else
+			corpus_input(&corpus, s->replay, f, &in);
+		t0 = now_us();
+		game_step(&g, &in);
+		step += now_us() - t0;
+
+		ili9341_clear_stats();
+		render(&g);
+		cmds += ili9341_count.cmds;
+		bytes += ili9341_count.data;
+		if (ili9341_count.data > r->worst)
+			r->worst = ili9341_count.data;
+	}
+	r->cmds = (double) cmds / s->frames;
+	r->bytes = (double) bytes / s->frames;
+	r->step_us = step / s->frames;
+
+	if (dir) {
+		char path[256];
+		snprintf(path, sizeof(path), "%s/%s.ppm", dir, s->name);
+		if (ili9341_dump_ppm(path))
+			perror(path);
+	}
+}
+
+static double value(const Result *r, int m) {
+	switch (m) {
+	case 0: return r->cmds;
+	case 1: return r->bytes;
+	case 2: return r->worst;
+	default: return r->step_us;
+	}
+}
+
+/*
+ * Reads "scenario metric limit" lines; a limit of - or a missing line
+ * means the metric is not checked.
+ */
+static void read_limits(const char *path, double limits[][NO_METRICS]) {
+	char line[128], name[64], metric[32], limit[32];
+	unsigned s;
+	int m;
+	FILE *f = fopen(path, "r");
+
+	for (s = 0; s < no_scenarios; s++)
+		for (m = 0; m < NO_METRICS; m++)
+			limits[s][m] = -1;
+	if (!f) {
+		perror(path);
+		exit(1);
+	}
+	while (fgets(line, sizeof(line), f)) {
+		if (line[0] == '#'
+				|| sscanf(line, "%63s %31s %31s", name, metric, limit) != 3)
+			continue;
+		for (s = 0; s < no_scenarios; s++)
+			for (m = 0; m < NO_METRICS; m++)
+				if (!strcmp(name, scenarios[s].name)
+						&& !strcmp(metric, metrics[m]))
+					limits[s][m] = strcmp(limit, "-") ? atof(limit) : -1;
+	}
+	fclose(f);
+}
+
+/*
+ * Writes this run's limits over path. Rows already there for scenarios not
+ * run this time, such as the replays when there is no -r, are kept; those
+ * for scenarios that were run are replaced, never repeated.
+ */
+static int write_limits(const char *path, const Result *r) {
+	static char kept[MAX_SCENARIOS * NO_METRICS * 2][128];
+	char line[128], name[64];
+	unsigned s, n = 0, i;
+	int m;
+	FILE *f = fopen(path, "r");
+
+	while (f && n < sizeof(kept) / sizeof(kept[0])
+			&& fgets(line, sizeof(line), f)) {
+		if (line[0] == '#' || sscanf(line, "%63s", name) != 1)
+			continue;
+		for (s = 0; s < no_scenarios && strcmp(name, scenarios[s].name); s++)
+			;
+		if (s == no_scenarios)
+			strcpy(kept[n++], line);
+	}
+	if (f)
+		fclose(f);
+
+	if (!(f = fopen(path, "w")))
+		return -1;
+	fprintf(f, "# Limits for 'make bench', from 'make bench-limits': bus "
+		"traffic %.0f%% and\n# step time %.0fx over the run they were "
+		"taken from. Step time is only\n# checked with -T, on the machine "
+		"that recorded it.\n", (BUS_HEADROOM - 1) * 100, TIME_HEADROOM);
+	for (s = 0; s < no_scenarios; s++)
+		for (m = 0; m < NO_METRICS; m++)
+			fprintf(f, "%-12s %-8s %.2f\n", scenarios[s].name, metrics[m],
+				value(&r[s], m) * (m == STEP_US ? TIME_HEADROOM : BUS_HEADROOM));
+	for (i = 0; i < n; i++)
+		fputs(kept[i], f);
+	return fclose(f);
+}
+
+int main(int argc, char **argv) {
+	const char *check = NULL, *update = NULL, *dir = NULL;
+	double limits[MAX_SCENARIOS][NO_METRICS];
+	Result results[MAX_SCENARIOS];
+	uint16_t budget = BUDGET_MAX;
+	int opt, m, failed = 0, timing = 0;
+	unsigned s;
+
+	while ((opt = getopt(argc, argv, "r:c:Tu:b:o:")) != -1) {
+		switch (opt) {
+		case 'r':
+			if (add_replays(optarg)) {
+				perror(optarg);
+				return 1;
+			}
+			break;
+		case 'c':
+			check = optarg;
+			break;
+		case 'T':
+			timing = 1;
+			break;
+		case 'u':
+			update = optarg;
+			break;
+		case 'b':
+			budget = strtoul(optarg, NULL, 0);
+			break;
+		case 'o':
+			dir = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-r corpus] [-c limits] [-T] "
+				"[-u limits] [-b budget] [-o dir]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (check)
+		read_limits(check, limits);
+
+	printf("%-12s %6s %8s %8s %8s %8s\n", "scenario", "frames", "cmds/f",
+		"bytes/f", "worst", "step us");
+	for (s = 0; s < no_scenarios; s++) {
+		Result *r = &results[s], again;
+		int run;
+		play(&scenarios[s], budget, dir, r);
+		for (run = 1; run < RUNS; run++) {
+			play(&scenarios[s], budget, NULL, &again);
+			if (again.step_us < r->step_us)
+				r->step_us = again.step_us;
+		}
+		printf("%-12s %6u %8.1f %8.1f %8.0f %8.2f\n", scenarios[s].name,
+			scenarios[s].frames, r->cmds, r->bytes, r->worst, r->step_us);
+		for (m = 0; check && m < NO_METRICS; m++) {
+			if (limits[s][m] >= 0 && value(r, m) > limits[s][m]) {
+				int counts = m != STEP_US || timing;
+				printf("  %s %s %.2f is over its limit of %.2f%s\n",
+					scenarios[s].name, metrics[m], value(r, m), limits[s][m],
+					counts ? "" : " (timing, not checked without -T)");
+				failed |= counts;
+			}
+		}
+	}
+
+	if (update) {
+		if (write_limits(update, results)) {
+			perror(update);
+			return 1;
+		}
+		printf("wrote %s\n", update);
+	}
+	if (check)
+		printf(failed ? "FAILED\n" : "all within limits\n");
+	return failed;
+}
@@ -0,0 +1,67 @@
+/*
+ * Draws the title screen with lcd.c on the ILI9341 model and writes it as
+ * a PPM, for rle565 to turn into splash.h ('make splash'). Replacing the
+ * PPM with drawn art works as well, within rle565's colour limit.
+ *
+ *   splashgen [-o splash.ppm]
+ */
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "ili9341.h"
+#include "lcd.h"
+
+#undef printf
+
+#define STARS 70
+
+static void ship(int16_t x, int16_t y, uint16_t col) {
+	draw_line(x, y - 12, x - 8, y + 8, col);
+	draw_line(x, y - 12, x + 8, y + 8, col);
+	draw_line(x - 6, y + 4, x + 6, y + 4, col);
+}
+
+int main(int argc, char **argv) {
+	static const int16_t rocks[][3] = {
+		{ 24, 20, 40 }, { 262, 28, 30 }, { 40, 150, 15 }, { 250, 140, 40 },
+		{ 150, 24, 15 }, { 96, 176, 30 }, { 206, 186, 15 },
+	};
+	const char *out = "splash.ppm";
+	uint32_t rng = 1;
+	int opt, i;
+
+	while ((opt = getopt(argc, argv, "o:")) != -1) {
+		switch (opt) {
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-o splash.ppm]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	ili9341_reset();
+	init_lcd();
+	for (i = 0; i < STARS; i++) {
+		rng = rng * 1103515245 + 12345;
+		draw_pixel((rng >> 8) % display.width, (rng >> 20) % display.height,
+			i % 3 ? GREY : WHITE);
+	}
+	for (i = 0; i < (int) (sizeof(rocks) / sizeof(rocks[0])); i++)
+		draw_outline_rectangle(rocks[i][0], rocks[i][1], rocks[i][2],
+			rocks[i][2], WHITE);
+	ship(160, 140, WHITE);
+
+	display_color(YELLOW, BLACK);
+	display_string_scaled_xy("FortunAsteroids", 25, 78, 3);
+	display_color(GREY, BLACK);
+	display_string_xy("CENTER: play   UP: replay   DOWN: stress", 40, 212);
+
+	if (ili9341_dump_ppm(out)) {
+		perror(out);
+		return 1;
+	}
+	return 0;
+}
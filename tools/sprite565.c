@@ -0,0 +1,299 @@
+/*
+ * Cuts a sheet of sprite frames drawn on a key colour out of a binary PPM
+ * into the span format lcd.c's display_sprite() draws from flash (see
+ * lcd/lcd.h), written out as a C header holding a PROGMEM array of them
+ * and a table of where each starts.
+ *
+ *   sprite565 -s WxH [-f frames] [-c x,y] [-k key] [-n name] [-o out.h]
+ *             sheet.ppm
+ *
+ * Frames are W by H cells read left to right, then top to bottom, all of
+ * them unless -f says how many. Each is trimmed to its opaque pixels and
+ * the origin, which is the middle of the cell unless -c puts it elsewhere.
+ * key is the RGB565 colour left out, magenta (0xf81f) by default. All the
+ * frames share one palette, so recolouring index i means the same on each;
+ * there may be at most IMAGE_COLOURS colours in it. The header defines
+ * NAME_FRAMES, name[] and name_frames[], the offset of each frame in name.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lcd.h"
+
+#undef printf
+
+#define MAX_RUN 16
+
+typedef struct {
+	unsigned w, h;
+	uint16_t *pixels;
+} Image;
+
+typedef struct {
+	uint8_t *data;
+	size_t len, size;
+} Buffer;
+
+static uint16_t palette[IMAGE_COLOURS];
+static unsigned colours;
+
+static void put(Buffer *b, uint8_t byte) {
+	if (b->len == b->size) {
+		b->size = b->size ? b->size * 2 : 4096;
+		b->data = realloc(b->data, b->size);
+		if (!b->data) {
+			perror("realloc");
+			exit(1);
+		}
+	}
+	b->data[b->len++] = byte;
+}
+
+static void put16(Buffer *b, uint16_t w) {
+	put(b, w & 0xFF);
+	put(b, w >> 8);
+}
+
+/* Skips whitespace and # comments between PPM header fields. */
+static int field(FILE *f, unsigned *v) {
+	int c;
+	while ((c = getc(f)) != EOF) {
+		if (c == '#')
+			while ((c = getc(f)) != EOF && c != '\n')
+				;
+		else if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			break;
+	}
+	if (c == EOF)
+		return -1;
+	ungetc(c, f);
+	return fscanf(f, "%u", v) == 1 ? 0 : -1;
+}
+
+static int read_ppm(const char *path, Image *img) {
+	FILE *f = fopen(path, "rb");
+	unsigned max, i;
+	uint8_t rgb[3];
+
+	if (!f)
+		return -1;
+	if (getc(f) != 'P' || getc(f) != '6' || field(f, &img->w)
+			|| field(f, &img->h) || field(f, &max) || max != 255
+			|| getc(f) == EOF) {
+		fprintf(stderr, "%s: not an 8-bit binary PPM\n", path);
+		fclose(f);
+		return -1;
+	}
+	img->pixels = malloc(sizeof(uint16_t) * img->w * img->h);
+	for (i = 0; i < img->w * img->h; i++) {
+		if (fread(rgb, 3, 1, f) != 1) {
+			fprintf(stderr, "%s: short image\n", path);
+			fclose(f);
+			return -1;
+		}
+		img->pixels[i] = (rgb[0] >> 3) << 11 | (rgb[1] >> 2) << 5 | rgb[2] >> 3;
+	}
+	fclose(f);
+	return 0;
+}
+
+/* The palette index of col, added if new; -1 if the palette is full. */
+static int colour(uint16_t col) {
+	unsigned c;
+	for (c = 0; c < colours && palette[c] != col; c++)
+		;
+	if (c == colours) {
+		if (colours == IMAGE_COLOURS)
+			return -1;
+		palette[colours++] = col;
+	}
+	return c;
+}
+
+/*
+ * Encodes the cell at cx, cy with its origin at ox, oy into b. Returns the
+ * number of spans, or -1 if the sheet has too many colours.
+ */
+static long encode(const Image *img, unsigned cx, unsigned cy, unsigned cw,
+		unsigned ch, unsigned ox, unsigned oy, uint16_t key, Buffer *b) {
+	unsigned left = ox, right = ox, top = oy, bottom = oy, x, y;
+	long spans = 0;
+
+#define PIXEL(x, y) img->pixels[(cy + (y)) * img->w + cx + (x)]
+	for (y = 0; y < ch; y++)
+		for (x = 0; x < cw; x++)
+			if (PIXEL(x, y) != key) {
+				left = x < left ? x : left;
+				right = x > right ? x : right;
+				top = y < top ? y : top;
+				bottom = y > bottom ? y : bottom;
+			}
+
+	put(b, right - left + 1);
+	put(b, bottom - top + 1);
+	put(b, ox - left);
+	put(b, oy - top);
+	put(b, colours);
+	for (x = 0; x < colours; x++)
+		put16(b, palette[x]);
+
+	for (y = top; y <= bottom; y++) {
+		size_t count = b->len;
+		uint8_t n = 0;
+		put(b, 0);
+		for (x = left; x <= right; ) {
+			unsigned start, len;
+			if (PIXEL(x, y) == key) {
+				x++;
+				continue;
+			}
+			for (start = x; x <= right && PIXEL(x, y) != key; x++)
+				;
+			put(b, start - left);
+			put(b, x - start);
+			for (; start < x; start += len) {
+				int c = colour(PIXEL(start, y));
+				if (c < 0)
+					return -1;
+				for (len = 1; start + len < x && len < MAX_RUN
+						&& PIXEL(start + len, y) == PIXEL(start, y); len++)
+					;
+				put(b, (len - 1) << 4 | c);
+			}
+			n++;
+		}
+		b->data[count] = n;
+		spans += n;
+	}
+#undef PIXEL
+	return spans;
+}
+
+/*
+ * Gives every colour in the sheet its index up front, in the order they
+ * are first seen, so each frame's header lists the whole palette.
+ */
+static int collect(const Image *img, uint16_t key) {
+	unsigned i;
+	for (i = 0; i < img->w * img->h; i++)
+		if (img->pixels[i] != key && colour(img->pixels[i]) < 0)
+			return -1;
+	return 0;
+}
+
+static void usage(const char *prog) {
+	fprintf(stderr, "usage: %s -s WxH [-f frames] [-c x,y] [-k key] "
+		"[-n name] [-o out.h] sheet.ppm\n", prog);
+	exit(1);
+}
+
+int main(int argc, char **argv) {
+	const char *name = "sprite", *out = NULL;
+	unsigned cw = 0, ch = 0, ox = ~0u, oy = ~0u, frames = 0, cols, f;
+	uint16_t key = 0xF81F;
+	Buffer b = { NULL, 0, 0 };
+	size_t *offsets, i;
+	Image img;
+	FILE *file = stdout;
+	long spans = 0, raw = 0;
+	char upper[64];
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:f:c:k:n:o:")) != -1) {
+		switch (opt) {
+		case 's':
+			if (sscanf(optarg, "%ux%u", &cw, &ch) != 2)
+				usage(argv[0]);
+			break;
+		case 'f':
+			frames = strtoul(optarg, NULL, 0);
+			break;
+		case 'c':
+			if (sscanf(optarg, "%u,%u", &ox, &oy) != 2)
+				usage(argv[0]);
+			break;
+		case 'k':
+			key = strtoul(optarg, NULL, 16);
+			break;
+		case 'n':
+			name = optarg;
+			break;
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1 || !cw || !ch || cw > 255 || ch > 255)
+		usage(argv[0]);
+	if (ox == ~0u) {
+		ox = cw / 2;
+		oy = ch / 2;
+	}
+	if (ox >= cw || oy >= ch) {
+		fprintf(stderr, "origin %u,%u is outside the %ux%u cell\n", ox, oy,
+			cw, ch);
+		return 1;
+	}
+	if (read_ppm(argv[optind], &img)) {
+		perror(argv[optind]);
+		return 1;
+	}
+	cols = img.w / cw;
+	if (!frames)
+		frames = cols * (img.h / ch);
+	if (!cols || frames > cols * (img.h / ch)) {
+		fprintf(stderr, "%s: %ux%u holds fewer than %u %ux%u frames\n",
+			argv[optind], img.w, img.h, frames, cw, ch);
+		return 1;
+	}
+	if (collect(&img, key)) {
+		fprintf(stderr, "%s: more than %d colours in RGB565\n", argv[optind],
+			IMAGE_COLOURS);
+		return 1;
+	}
+
+	offsets = malloc(sizeof(size_t) * frames);
+	for (f = 0; f < frames; f++) {
+		offsets[f] = b.len;
+		spans += encode(&img, f % cols * cw, f / cols * ch, cw, ch, ox, oy,
+			key, &b);
+		raw += 2 * b.data[offsets[f]] * b.data[offsets[f] + 1];
+	}
+	if (b.len > 0xFFFF) {
+		fprintf(stderr, "%s: %lu bytes is too many to index\n", argv[optind],
+			(unsigned long) b.len);
+		return 1;
+	}
+
+	for (i = 0; name[i] && i < sizeof(upper) - 1; i++)
+		upper[i] = toupper((unsigned char) name[i]);
+	upper[i] = '\0';
+	if (out && !(file = fopen(out, "w"))) {
+		perror(out);
+		return 1;
+	}
+	fprintf(file, "/* %u %ux%u sprites from %s, by tools/sprite565: %lu "
+		"bytes, %ld spans. */\n\n#include <avr/pgmspace.h>\n\n"
+		"#define %s_FRAMES %u\n\nconst uint8_t %s[] PROGMEM = {", frames, cw,
+		ch, argv[optind], (unsigned long) b.len, spans, upper, frames, name);
+	for (i = 0; i < b.len; i++)
+		fprintf(file, "%s0x%02x,", i % 12 ? " " : "\n\t", b.data[i]);
+	fprintf(file, "\n};\n\nconst uint16_t %s_frames[%s_FRAMES] PROGMEM = {",
+		name, upper);
+	for (f = 0; f < frames; f++)
+		fprintf(file, "%s%lu,", f % 8 ? " " : "\n\t", (unsigned long) offsets[f]);
+	fprintf(file, "\n};\n");
+	if (file != stdout && fclose(file)) {
+		perror(out);
+		return 1;
+	}
+	fprintf(stderr, "%s: %u frames, %ld bytes raw when trimmed, %lu encoded, "
+		"%ld spans\n", argv[optind], frames, raw, (unsigned long) b.len, spans);
+	return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * Draws the ship with lcd.c on the ILI9341 model, in the same lines
+ * render.c used to draw it with, at SHIP_ROTATIONS angles and then again
+ * with the flame lit, on a magenta key, and writes the sheet as a PPM for
+ * sprite565 to turn into ship.h ('make sprites').
+ *
+ *   spritegen [-o ship.ppm]
+ *
+ * Frame r faces r turns of 2 pi / SHIP_ROTATIONS clockwise from up, in
+ * CELL pixel cells read left to right, then top to bottom, with the ship's
+ * origin in the middle of each.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "game.h"
+#include "ili9341.h"
+#include "lcd.h"
+
+#undef printf
+
+#define SHIP_ROTATIONS 32
+#define CELL 28
+
+// The ship as place_ship() lays it out about its origin, facing up.
+static const int8_t outline[SHIP_POINTS][2] = {
+	{ -6, 8 }, { 6, 8 }, { 0, -10 }, { -5, 5 }, { 5, 5 },
+	{ -3, 5 }, { 0, 11 }, { 3, 5 },
+};
+
+// Pairs of points joined by a line, the last two only under thrust.
+static const uint8_t lines[][2] = {
+	{ 0, 2 }, { 2, 1 }, { 3, 4 }, { 5, 6 }, { 6, 7 },
+};
+
+static void ship(uint16_t frame) {
+	uint8_t r = frame % SHIP_ROTATIONS, flame = frame >= SHIP_ROTATIONS;
+	uint16_t cols = display.width / CELL;
+	float ox = (frame % cols) * CELL + CELL / 2;
+	float oy = (frame / cols) * CELL + CELL / 2;
+	float s = sin(2 * PI * r / SHIP_ROTATIONS);
+	float c = cos(2 * PI * r / SHIP_ROTATIONS);
+	float x[SHIP_POINTS], y[SHIP_POINTS];
+	uint8_t i;
+
+	for (i = 0; i < SHIP_POINTS; i++) {
+		x[i] = ox + outline[i][0] * c - outline[i][1] * s;
+		y[i] = oy + outline[i][0] * s + outline[i][1] * c;
+	}
+	for (i = 0; i < (flame ? 5 : 3); i++)
+		draw_line(x[lines[i][0]], y[lines[i][0]], x[lines[i][1]],
+			y[lines[i][1]], WHITE);
+}
+
+int main(int argc, char **argv) {
+	const char *out = "ship.ppm";
+	rectangle all;
+	uint16_t f;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "o:")) != -1) {
+		switch (opt) {
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-o ship.ppm]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	ili9341_reset();
+	init_lcd();
+	all.left = 0;
+	all.right = display.width - 1;
+	all.top = 0;
+	all.bottom = display.height - 1;
+	fill_rectangle(all, MAGENTA);
+	for (f = 0; f < 2 * SHIP_ROTATIONS; f++)
+		ship(f);
+
+	if (ili9341_dump_ppm(out)) {
+		perror(out);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * Decodes the telemetry stream from the board (see telemetry.h).
+ *
+ *   teledec [-s] [-b baud] [-c cycles] [device | file | -]
+ *
+ * Reads from a serial device (configured raw at the given baud rate), a
+ * recorded file or stdin, and writes one CSV row per tick frame. With -s it
+ * prints a one-line summary every second of game time instead.
+ * -c sets CPU cycles per clock count (8 for the LaFortuna at 8MHz).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "telemetry.h"
+#include "teleparse.h"
+
+#define SUMMARY_FRAMES 20
+
+static int summary = 0;
+static unsigned cycles = 8;
+
+static unsigned long lost_ticks;
+static int have_tick = 0;
+static uint16_t last_tick;
+
+static struct {
+	unsigned long n, steps, draw, frame, budget, events;
+	unsigned long draw_max, frame_max, budget_max;
+	unsigned idle_min;
+	uint16_t missed;
+} sum;
+
+static void summary_line(void) {
+	if (!sum.n)
+		return;
+	printf("frames %lu  crc-err %lu  lost %lu | steps %.2f  draw avg %lu max %lu"
+		"  frame max %lu cyc | lcd budget avg %lu max %lu"
+		" | ev %lu  missed %u  idle min %u%%\n",
+		tele_frames, tele_crc_errors, lost_ticks, (double) sum.steps / sum.n,
+		sum.draw / sum.n * cycles, sum.draw_max * cycles,
+		sum.frame_max * cycles, sum.budget / sum.n, sum.budget_max,
+		sum.events, sum.missed, sum.idle_min);
+	fflush(stdout);
+	memset(&sum, 0, sizeof(sum));
+}
+
+static void on_tick(const tele_tick *t) {
+	if (have_tick && (uint16_t) (t->tick - last_tick) != t->steps)
+		lost_ticks += (uint16_t) (t->tick - last_tick - t->steps);
+	have_tick = 1;
+	last_tick = t->tick;
+
+	if (!summary) {
+		printf("%u,%u,%lu,%lu,%lu,%u,%u,%u,%u,%u,%u,%u,%u\n",
+			t->tick, t->steps, (unsigned long) t->step_t * cycles,
+			(unsigned long) t->draw_t * cycles,
+			(unsigned long) t->frame_t * cycles, t->lcd_budget_used, t->missed,
+			t->asteroids, t->bullets, t->debris, t->events, t->held, t->idle);
+		return;
+	}
+
+	if (!sum.n)
+		sum.idle_min = 100;
+	sum.n++;
+	sum.steps += t->steps;
+	sum.draw += t->draw_t;
+	sum.frame += t->frame_t;
+	sum.budget += t->lcd_budget_used;
+	sum.events += t->events;
+	if (t->draw_t > sum.draw_max) sum.draw_max = t->draw_t;
+	if (t->frame_t > sum.frame_max) sum.frame_max = t->frame_t;
+	if (t->lcd_budget_used > sum.budget_max)
+		sum.budget_max = t->lcd_budget_used;
+	if (t->idle < sum.idle_min) sum.idle_min = t->idle;
+	sum.missed = t->missed;
+	if (sum.n == SUMMARY_FRAMES)
+		summary_line();
+}
+
+static void on_latency(const tele_latency *l) {
+	unsigned long seen = 0;
+	unsigned p50 = 0, p99 = 0, i;
+	unsigned n = sizeof(l->hist) / sizeof(l->hist[0]);
+	for (i = 0; i < n; i++) {
+		seen += l->hist[i];
+		if (!p50 && seen * 100 >= (unsigned long) l->count * 50)
+			p50 = (i + 1) * l->bucket_us / 1000;
+		if (!p99 && seen * 100 >= (unsigned long) l->count * 99)
+			p99 = (i + 1) * l->bucket_us / 1000;
+	}
+	printf("# latency n=%u p50<=%ums p99<=%ums max=%ums\n",
+		l->count, p50, p99, l->max_ms);
+	fflush(stdout);
+}
+
+static void on_frame(uint8_t type, const uint8_t *payload, uint8_t len) {
+	if (type == TELE_TICK && len == sizeof(tele_tick)) {
+		tele_tick t;
+		memcpy(&t, payload, sizeof(t));
+		on_tick(&t);
+	} else if (type == TELE_LATENCY && len == sizeof(tele_latency)) {
+		tele_latency l;
+		memcpy(&l, payload, sizeof(l));
+		on_latency(&l);
+	}
+}
+
+int main(int argc, char **argv) {
+	long baud = TELE_BAUD;
+	int opt, fd;
+
+	while ((opt = getopt(argc, argv, "sb:c:")) != -1) {
+		switch (opt) {
+		case 's': summary = 1; break;
+		case 'b': baud = atol(optarg); break;
+		case 'c': cycles = atoi(optarg); break;
+		default:
+			fprintf(stderr,
+				"usage: teledec [-s] [-b baud] [-c cycles] [device|file|-]\n");
+			return 2;
+		}
+	}
+	fd = tele_open(optind < argc ? argv[optind] : NULL, baud);
+	if (fd < 0)
+		return 1;
+
+	if (!summary)
+		printf("tick,steps,step_cycles,draw_cycles,frame_cycles,lcd_budget_used,"
+			"missed,asteroids,bullets,debris,events,held,idle\n");
+
+	tele_read(fd, on_frame);
+
+	if (summary)
+		summary_line();
+	fprintf(stderr, "teledec: %lu frames, %lu crc errors, %lu ticks lost\n",
+		tele_frames, tele_crc_errors, lost_ticks);
+	return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Writes a simulated telemetry stream to stdout, for exercising teledec
+ * without a board.
+ *
+ *   telegen [-n frames] [-e every] [-s seed]
+ *
+ * Every -e'th frame is corrupted and a few noise bytes are put between
+ * frames; a latency frame follows every TELE_LATENCY_EVERY tick frames, and
+ * a trace dump of the frame follows every tick frame that reports a missed
+ * tick.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "telemetry.h"
+#include "trace.h"
+
+static void emit(uint8_t type, const void *payload, uint8_t len, int corrupt) {
+	uint8_t f[TELE_MAX_PAYLOAD + 6];
+	uint16_t crc = 0xFFFF;
+	int i;
+
+	f[0] = TELE_SYNC0;
+	f[1] = TELE_SYNC1;
+	f[2] = type;
+	f[3] = len;
+	memcpy(&f[4], payload, len);
+	for (i = 2; i < len + 4; i++)
+		crc = tele_crc_update(crc, f[i]);
+	f[len + 4] = crc;
+	f[len + 5] = crc >> 8;
+	if (corrupt)
+		f[4 + rand() % len] ^= 0x10;
+	fwrite(f, 1, len + 6, stdout);
+}
+
+/*
+ * A frozen ring holding one tick: steps, then the draw phases, then the
+ * overrun, split into TRACE_CHUNK sized frames.
+ */
+static void emit_trace(uint16_t dump, const tele_tick *t) {
+	static const uint8_t draws[] = { TR_DRAW_HUD, TR_DRAW_WRECKAGE,
+		TR_DRAW_SHIP, TR_DRAW_BULLETS, TR_DRAW_DEBRIS, TR_DRAW_ASTEROIDS };
+	trace_event ev[TRACE_DEPTH];
+	uint8_t buf[sizeof(trace_chunk) + TRACE_CHUNK * sizeof(trace_event)];
+	trace_chunk c;
+	uint16_t now = rand();
+	int n = 0, i, k;
+
+#define EV(w, dt) (ev[n].time = now += (dt), ev[n++].what = (w))
+	EV(TR_BEGIN | TR_TICK, 0);
+	for (i = 0; i < t->steps; i++) {
+		EV(TR_BEGIN | TR_STEP, 5);
+		EV(TR_BEGIN | TR_INPUT, 2);
+		EV(TR_END | TR_INPUT, 400);
+		EV(TR_BEGIN | TR_UPDATE, 2);
+		EV(TR_END | TR_UPDATE, t->step_t / t->steps);
+		EV(TR_END | TR_STEP, 2);
+	}
+	EV(TR_BEGIN | TR_DRAW, 3);
+	for (k = 0; k < (int) sizeof(draws); k++) {
+		EV(TR_BEGIN | draws[k], 2);
+		EV(TR_END | draws[k], t->draw_t / sizeof(draws));
+	}
+	EV(TR_END | TR_DRAW, 2);
+	EV(TR_INSTANT | TR_OVERRUN, 30);
+	EV(TR_END | TR_TICK, 40);
+#undef EV
+
+	c.dump = dump;
+	c.total = n;
+	for (c.first = 0; c.first < n; c.first += k) {
+		k = n - c.first < TRACE_CHUNK ? n - c.first : TRACE_CHUNK;
+		memcpy(buf, &c, sizeof(c));
+		memcpy(buf + sizeof(c), &ev[c.first], k * sizeof(trace_event));
+		emit(TELE_TRACE, buf, sizeof(c) + k * sizeof(trace_event), 0);
+	}
+}
+
+int main(int argc, char **argv) {
+	long n = 1000, every = 0, i;
+	uint16_t dumps = 0;
+	int opt, j;
+	tele_tick t;
+	tele_latency l;
+
+	while ((opt = getopt(argc, argv, "n:e:s:")) != -1) {
+		switch (opt) {
+		case 'n': n = atol(optarg); break;
+		case 'e': every = atol(optarg); break;
+		case 's': srand(atoi(optarg)); break;
+		default:
+			fprintf(stderr, "usage: telegen [-n frames] [-e every] [-s seed]\n");
+			return 2;
+		}
+	}
+
+	memset(&t, 0, sizeof(t));
+	memset(&l, 0, sizeof(l));
+	l.bucket_us = 2000;
+	for (i = 0; i < n; i++) {
+		t.steps = 1 + (rand() % 16 == 0);
+		t.tick += t.steps;
+		t.step_t = 2000 + rand() % 3000;
+		t.draw_t = 15000 + rand() % 30000;
+		t.frame_t = t.step_t + t.draw_t + 300;
+		t.lcd_budget_used = 8000 + rand() % 20000;
+		t.missed += t.steps - 1;
+		t.asteroids = rand() % 13;
+		t.bullets = rand() % 10;
+		t.debris = rand() % 10;
+		t.events = rand() % 3;
+		t.held = rand() & 0x1F;
+		t.idle = 100 - t.frame_t / 500;
+		emit(TELE_TICK, &t, sizeof(t), every && i % every == every - 1);
+		if (t.steps > 1)
+			emit_trace(dumps++, &t);
+
+		for (j = rand() % 3; j > 0; j--)
+			putchar(rand() & 0xFF);
+
+		// A slow tail, some of it in the overflow bucket.
+		l.hist[rand() % 50 ? 10 + rand() % 20 : 60 + rand() % 4]++;
+		l.count++;
+		if (i % TELE_LATENCY_EVERY == TELE_LATENCY_EVERY - 1) {
+			l.max_ms = 140;
+			emit(TELE_LATENCY, &l, sizeof(l), 0);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,117 @@
+#include "teleparse.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "telemetry.h"
+
+unsigned long tele_frames, tele_crc_errors;
+
+static speed_t baud_flag(long baud) {
+	switch (baud) {
+	case 9600: return B9600;
+	case 57600: return B57600;
+	case 115200: return B115200;
+	case 230400: return B230400;
+	case 500000: return B500000;
+	case 1000000: return B1000000;
+	case 2000000: return B2000000;
+	default: return B0;
+	}
+}
+
+/*
+ * Opens a serial device (set raw at baud), a file, or stdin for "-" or
+ * NULL. Returns -1 with a message on failure.
+ */
+int tele_open(const char *path, long baud) {
+	struct termios t;
+	int fd;
+
+	if (!path || !strcmp(path, "-"))
+		return 0;
+	fd = open(path, O_RDONLY | O_NOCTTY);
+	if (fd < 0) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return -1;
+	}
+	if (isatty(fd) && tcgetattr(fd, &t) == 0) {
+		if (baud_flag(baud) == B0) {
+			fprintf(stderr, "unsupported baud rate %ld\n", baud);
+			close(fd);
+			return -1;
+		}
+		cfmakeraw(&t);
+		cfsetispeed(&t, baud_flag(baud));
+		cfsetospeed(&t, baud_flag(baud));
+		t.c_cc[VMIN] = 1;
+		t.c_cc[VTIME] = 0;
+		tcsetattr(fd, TCSANOW, &t);
+	}
+	return fd;
+}
+
+/*
+ * Consumes as many whole frames from buf as it can and returns the number
+ * of bytes used. A bad CRC drops just the first sync byte, so a real frame
+ * starting inside the bad one is still found.
+ */
+static size_t parse(const uint8_t *buf, size_t n, tele_handler on_frame) {
+	size_t i = 0;
+	while (i + 4 <= n) {
+		if (buf[i] != TELE_SYNC0 || buf[i + 1] != TELE_SYNC1) {
+			i++;
+			continue;
+		}
+		uint8_t len = buf[i + 3];
+		if (len > TELE_MAX_PAYLOAD) {
+			i++;
+			continue;
+		}
+		if (i + len + 6 > n)
+			break;
+		uint16_t crc = 0xFFFF;
+		size_t k;
+		for (k = 2; k < (size_t) len + 4; k++)
+			crc = tele_crc_update(crc, buf[i + k]);
+		if ((buf[i + len + 4] | buf[i + len + 5] << 8) != crc) {
+			tele_crc_errors++;
+			i++;
+			continue;
+		}
+		tele_frames++;
+		on_frame(buf[i + 2], &buf[i + 4], len);
+		i += len + 6;
+	}
+	return i;
+}
+
+/*
+ * Reads fd to the end, calling on_frame for every good frame.
+ */
+int tele_read(int fd, tele_handler on_frame) {
+	uint8_t buf[4096];
+	size_t have = 0;
+
+	for (;;) {
+		ssize_t r = read(fd, buf + have, sizeof(buf) - have);
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0)
+			return -1;
+		if (r == 0)
+			return 0;
+		have += r;
+		size_t used = parse(buf, have, on_frame);
+		// Keep a partial frame; anything longer than a frame is garbage.
+		if (!used && have == sizeof(buf))
+			used = have - (TELE_MAX_PAYLOAD + 6);
+		memmove(buf, buf + used, have - used);
+		have -= used;
+	}
+}
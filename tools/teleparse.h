@@ -0,0 +1,18 @@
+/*
+ * Frame parser for the telemetry stream, shared by the host tools.
+ */
+
+#ifndef TELEPARSE_H
+#define TELEPARSE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*tele_handler)(uint8_t type, const uint8_t *payload, uint8_t len);
+
+extern unsigned long tele_frames, tele_crc_errors;
+
+int tele_open(const char *path, long baud);
+int tele_read(int fd, tele_handler on_frame);
+
+#endif
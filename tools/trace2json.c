@@ -0,0 +1,93 @@
+/*
+ * Converts the trace dumps in a telemetry stream (TELE_TRACE frames, see
+ * trace.h) to Chrome/Perfetto trace JSON.
+ *
+ *   trace2json [-b baud] [-u us] [device | file | -] > trace.json
+ *
+ * Each complete dump becomes its own process in the trace, with time 0 at
+ * its oldest event. -u sets microseconds per clock count (1 at 8MHz).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "telemetry.h"
+#include "teleparse.h"
+#include "trace.h"
+
+#define TRACE_NAME(id, name) name,
+static const char *names[] = { TRACE_IDS(TRACE_NAME) };
+
+static double us_per_count = 1.0;
+static trace_event events[256];
+static int have = -1; // Events collected for the current dump, -1 if none.
+static uint16_t current;
+static int dumps = 0;
+
+static void emit_dump(int total) {
+	unsigned long t = 0;
+	int i;
+
+	for (i = 0; i < total; i++) {
+		uint8_t id = events[i].what & TR_ID_MASK;
+		uint8_t kind = events[i].what & ~TR_ID_MASK;
+		// Timestamps wrap at 16 bits; events are in order, so unwrap.
+		if (i)
+			t += (uint16_t) (events[i].time - events[i - 1].time);
+		printf("%s\n  {\"name\": \"%s\", \"ph\": \"%s\", \"ts\": %.1f, "
+			"\"pid\": %u, \"tid\": 0%s}",
+			dumps ? "," : "", id < TR_COUNT ? names[id] : "?",
+			kind == TR_BEGIN ? "B" : kind == TR_END ? "E" : "i",
+			t * us_per_count, current, kind == TR_INSTANT ? ", \"s\": \"p\"" : "");
+		dumps = 1;
+	}
+}
+
+static void on_frame(uint8_t type, const uint8_t *payload, uint8_t len) {
+	trace_chunk c;
+	int n;
+
+	if (type != TELE_TRACE || len < sizeof(c))
+		return;
+	memcpy(&c, payload, sizeof(c));
+	n = (len - sizeof(c)) / sizeof(trace_event);
+
+	if (c.first == 0) {
+		have = 0;
+		current = c.dump;
+	}
+	// A chunk went missing; drop the rest of this dump.
+	if (have != c.first || c.dump != current || c.first + n > c.total)
+		return;
+	memcpy(&events[have], payload + sizeof(c), n * sizeof(trace_event));
+	have += n;
+	if (have == c.total) {
+		emit_dump(have);
+		have = -1;
+	}
+}
+
+int main(int argc, char **argv) {
+	long baud = TELE_BAUD;
+	int opt, fd;
+
+	while ((opt = getopt(argc, argv, "b:u:")) != -1) {
+		switch (opt) {
+		case 'b': baud = atol(optarg); break;
+		case 'u': us_per_count = atof(optarg); break;
+		default:
+			fprintf(stderr, "usage: trace2json [-b baud] [-u us] [device|file|-]\n");
+			return 2;
+		}
+	}
+	fd = tele_open(optind < argc ? argv[optind] : NULL, baud);
+	if (fd < 0)
+		return 1;
+
+	printf("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+	tele_read(fd, on_frame);
+	printf("\n]}\n");
+	return 0;
+}
@@ -0,0 +1,346 @@
+/*
+ * Searches seeds and input sequences for the most expensive tick the game
+ * can be driven into, since the frame budget has to cover the worst tick
+ * and random play seldom finds it.
+ *
+ *   worstcase [-g generations] [-P population] [-t ticks] [-n top]
+ *             [-f bytes|lcd|tests] [-r search-seed] [-o worst.corpus]
+ *
+ * A (mu + lambda) evolutionary search: each candidate is a seed and one
+ * input per tick, scored by the largest per-tick value of -f over its run:
+ * the data bytes render() sends the ILI9341 model, the render_cost()
+ * estimate (much faster, but it ranks frames poorly), or collision tests
+ * in update(). Children come from tournament-picked parents by splicing
+ * two input sequences and rewriting stretches of input, mostly just
+ * before the parent's worst tick.
+ *
+ * The best candidates for the top distinct seeds are listed with what
+ * their worst frame sends and holds. -o saves them, cut off after their
+ * worst tick, as a replay corpus for 'make bench' to play as scenarios.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "corpus.h"
+#include "game.h"
+#include "ili9341.h"
+#include "lcd.h"
+#include "render.h"
+#include "replay.h"
+
+#undef printf
+
+#define MAX_TICKS 6000
+#define ELITE 4
+#define TOURNAMENT 3
+
+typedef struct {
+	uint16_t seed;
+	uint32_t score;    // Largest per-tick value of the metric searched on.
+	uint16_t worst;    // The tick it came at (the first, on a tie).
+	uint8_t in[MAX_TICKS]; // REPLAY_F_* flags per tick.
+} Candidate;
+
+typedef struct {
+	uint32_t bytes;    // render() data bytes at the worst tick.
+	uint32_t peak;     // Most in any frame of the run.
+	uint16_t peak_tick;
+	uint32_t values[CORPUS_GAME_METRICS]; // At the worst tick.
+} Measured;
+
+#define BYTES -1 // Search on render() bytes, not one of corpus_game_names.
+
+static unsigned ticks = 800; // 40s of play: long enough to fill the field.
+static int metric = BYTES;
+static uint32_t rng;
+
+static uint32_t next() {
+	rng ^= rng << 13;
+	rng ^= rng >> 17;
+	rng ^= rng << 5;
+	return rng;
+}
+
+static void input_of(uint8_t f, GameInput *in) {
+	in->held = (f & REPLAY_F_THRUST ? INPUT_THRUST : 0)
+		| (f & REPLAY_F_RIGHT ? INPUT_RIGHT : 0)
+		| (f & REPLAY_F_LEFT ? INPUT_LEFT : 0);
+	in->pressed = f & REPLAY_F_FIRE ? INPUT_FIRE : 0;
+	in->turn = 0;
+}
+
+static void start(Game *g, uint16_t seed) {
+	ili9341_reset();
+	init_lcd();
+	render_reset();
+	render_budget = BUDGET_MAX;
+	game_init(g, seed);
+	g->state = PLAY_STATE;
+}
+
+static void evaluate(Candidate *c) {
+	static Game g;
+	unsigned t;
+
+	start(&g, c->seed);
+	c->score = 0;
+	c->worst = 0;
+	for (t = 0; t < ticks; t++) {
+		uint32_t v[CORPUS_GAME_METRICS], score;
+		GameInput in;
+		input_of(c->in[t], &in);
+		corpus_measure(&g, &in, v);
+		if (metric == BYTES) {
+			ili9341_clear_stats();
+			render(&g);
+			score = ili9341_count.data;
+		} else {
+			score = v[metric];
+		}
+		if (score > c->score) {
+			c->score = score;
+			c->worst = t;
+		}
+	}
+}
+
+/*
+ * Rewrites ticks [from, from + len) with one held direction and a shot
+ * every few ticks, or none.
+ */
+static void rewrite(Candidate *c, unsigned from, unsigned len) {
+	uint8_t held = next() & REPLAY_F_HELD;
+	unsigned every = next() % 9, t;
+	for (t = from; t < from + len && t < ticks; t++)
+		c->in[t] = held | (every && t % every == 0 ? REPLAY_F_FIRE : 0);
+}
+
+static void random_candidate(Candidate *c) {
+	unsigned t = 0;
+	c->seed = next();
+	while (t < ticks) {
+		unsigned len = 1 + next() % 40;
+		rewrite(c, t, len);
+		t += len;
+	}
+}
+
+static const Candidate *pick(Candidate *pop, int n) {
+	const Candidate *best = &pop[next() % n];
+	int i;
+	for (i = 1; i < TOURNAMENT; i++) {
+		const Candidate *c = &pop[next() % n];
+		if (c->score > best->score)
+			best = c;
+	}
+	return best;
+}
+
+static void breed(Candidate *child, const Candidate *a, const Candidate *b) {
+	unsigned cut, n, i;
+
+	*child = *a;
+	if (next() % 20 == 0) {
+		child->seed = next();
+		return;
+	}
+	if (next() % 3 == 0 && b->seed == a->seed) {
+		cut = next() % ticks;
+		memcpy(child->in + cut, b->in + cut, ticks - cut);
+	}
+	n = 1 + next() % 3;
+	for (i = 0; i < n; i++) {
+		unsigned len = 1 + next() % 64;
+		unsigned from;
+		// Mostly the run-up to the worst tick, where a change pays off.
+		if (next() % 2 && a->worst > 0)
+			from = a->worst - next() % (a->worst < 200 ? a->worst : 200);
+		else
+			from = next() % ticks;
+		rewrite(child, from, len);
+	}
+}
+
+static int by_score(const void *x, const void *y) {
+	const Candidate *a = x, *b = y;
+	if (a->score != b->score)
+		return a->score < b->score ? 1 : -1;
+	if (a->worst != b->worst)
+		return a->worst < b->worst ? -1 : 1;
+	return a->seed < b->seed ? -1 : a->seed > b->seed;
+}
+
+/*
+ * Keeps the best candidate seen for each of the top distinct seeds.
+ */
+static void remember(Candidate *hall, int *n, int top, const Candidate *c) {
+	int i;
+	for (i = 0; i < *n; i++) {
+		if (hall[i].seed == c->seed) {
+			if (by_score(c, &hall[i]) < 0)
+				hall[i] = *c;
+			goto sort;
+		}
+	}
+	if (*n < top)
+		hall[(*n)++] = *c;
+	else if (by_score(c, &hall[top - 1]) < 0)
+		hall[top - 1] = *c;
+	else
+		return;
+sort:
+	qsort(hall, *n, sizeof(*hall), by_score);
+}
+
+/*
+ * Plays c through render() on the ILI9341 model, up to its worst tick.
+ */
+static void measure(const Candidate *c, Measured *m) {
+	static Game g;
+	unsigned t;
+
+	start(&g, c->seed);
+	memset(m, 0, sizeof(*m));
+	for (t = 0; t <= c->worst; t++) {
+		uint32_t v[CORPUS_GAME_METRICS];
+		GameInput in;
+		input_of(c->in[t], &in);
+		corpus_measure(&g, &in, v);
+		ili9341_clear_stats();
+		render(&g);
+		if (ili9341_count.data > m->peak) {
+			m->peak = ili9341_count.data;
+			m->peak_tick = t;
+		}
+		if (t == c->worst) {
+			m->bytes = ili9341_count.data;
+			memcpy(m->values, v, sizeof(v));
+		}
+	}
+}
+
+static int save_corpus(const char *path, const Candidate *hall, int n) {
+	unsigned long total = 0;
+	CorpusWriter w;
+	static Game g;
+	int i;
+	unsigned t;
+
+	for (i = 0; i < n; i++)
+		total += hall[i].worst + 1;
+	if (corpus_create(&w, path, n, total, corpus_game_names,
+			corpus_game_widths, CORPUS_GAME_METRICS))
+		return -1;
+	for (i = 0; i < n; i++) {
+		game_init(&g, hall[i].seed);
+		g.state = PLAY_STATE;
+		corpus_begin(&w, hall[i].seed, 0);
+		for (t = 0; t <= hall[i].worst; t++) {
+			uint32_t v[CORPUS_GAME_METRICS];
+			GameInput in;
+			input_of(hall[i].in[t], &in);
+			corpus_measure(&g, &in, v);
+			corpus_put(&w, &in, v);
+		}
+	}
+	return corpus_finish(&w);
+}
+
+int main(int argc, char **argv) {
+	const char *corpus = NULL;
+	unsigned generations = 60, gen;
+	int population = 24, top = 5, opt, i, held = 0;
+	Candidate *pop, *kids, *hall;
+	Measured *m;
+
+	rng = 0x2545F491;
+	while ((opt = getopt(argc, argv, "g:P:t:n:f:r:o:")) != -1) {
+		switch (opt) {
+		case 'g':
+			generations = strtoul(optarg, NULL, 0);
+			break;
+		case 'P':
+			population = atoi(optarg);
+			break;
+		case 't':
+			ticks = strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			top = atoi(optarg);
+			break;
+		case 'f':
+			if (!strcmp(optarg, "lcd"))
+				metric = 0;
+			else if (!strcmp(optarg, "tests"))
+				metric = 4;
+			else
+				metric = BYTES;
+			break;
+		case 'r':
+			rng = strtoul(optarg, NULL, 0);
+			break;
+		case 'o':
+			corpus = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-g generations] [-P population] "
+				"[-t ticks] [-n top] [-f bytes|lcd|tests] [-r search-seed] "
+				"[-o worst.corpus]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (ticks < 1 || ticks > MAX_TICKS)
+		ticks = MAX_TICKS;
+	if (population <= ELITE)
+		population = ELITE + 1;
+	if (top < 1)
+		top = 1;
+	if (!rng)
+		rng = 1;
+
+	pop = malloc(population * sizeof(*pop));
+	kids = malloc(population * sizeof(*kids));
+	hall = malloc(top * sizeof(*hall));
+	m = malloc(top * sizeof(*m));
+	for (i = 0; i < population; i++) {
+		random_candidate(&pop[i]);
+		evaluate(&pop[i]);
+		remember(hall, &held, top, &pop[i]);
+	}
+
+	for (gen = 1; gen <= generations; gen++) {
+		qsort(pop, population, sizeof(*pop), by_score);
+		memcpy(kids, pop, ELITE * sizeof(*pop));
+		for (i = ELITE; i < population; i++) {
+			breed(&kids[i], pick(pop, population), pick(pop, population));
+			evaluate(&kids[i]);
+			remember(hall, &held, top, &kids[i]);
+		}
+		memcpy(pop, kids, population * sizeof(*pop));
+		if (gen % 10 == 0 || gen == generations)
+			printf("generation %u: best %u %s at tick %u of seed %u\n", gen,
+				hall[0].score, metric == BYTES ? "bytes"
+				: corpus_game_names[metric], hall[0].worst, hall[0].seed);
+	}
+
+	printf("%4s %6s %6s %8s %8s %8s %5s %5s %5s %5s\n", "rank", "seed", "tick",
+		"estimate", "bytes", "peak", "ast", "bul", "deb", "tests");
+	for (i = 0; i < held; i++) {
+		measure(&hall[i], &m[i]);
+		printf("%4d %6u %6u %8u %8u %8u %5u %5u %5u %5u\n", i + 1, hall[i].seed,
+			hall[i].worst, m[i].values[0], m[i].bytes, m[i].peak,
+			m[i].values[1], m[i].values[2], m[i].values[3], m[i].values[4]);
+	}
+
+	if (corpus) {
+		if (save_corpus(corpus, hall, held)) {
+			perror(corpus);
+			return 1;
+		}
+		printf("wrote %s\n", corpus);
+	}
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include "trace.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "clock.h"
+#include "telemetry.h"
+
+#ifdef TRACE
+
+trace_event trace_ring[TRACE_DEPTH];
+uint8_t trace_head = 0;   // Next slot to write.
+uint8_t trace_filled = 0; // Events in the ring, up to TRACE_DEPTH.
+uint8_t trace_frozen = 0;
+uint8_t trace_sent = 0;   // Events of the frozen ring already dumped.
+uint16_t trace_dumps = 0;
+
+/*
+ * LCD primitives are traced as one span per run of calls: a begin straight
+ * after the end of the same primitive takes that end back, so the span
+ * stretches over the whole run. A draw_pixel per bullet, or per step of a
+ * line, then costs the ring two events rather than two each.
+ */
+void trace_record(uint8_t what) {
+	if (trace_frozen)
+		return;
+	uint8_t sreg = SREG;
+	cli();
+	if ((what & ~TR_ID_MASK) == TR_BEGIN && what >= TR_LCD_FILL
+			&& trace_filled) {
+		uint8_t last = trace_head ? trace_head - 1 : TRACE_DEPTH - 1;
+		if (trace_ring[last].what == (TR_END | what)) {
+			trace_head = last;
+			trace_filled--;
+			SREG = sreg;
+			return;
+		}
+	}
+	trace_ring[trace_head].time = clock_now();
+	trace_ring[trace_head].what = what;
+	if (++trace_head == TRACE_DEPTH)
+		trace_head = 0;
+	if (trace_filled < TRACE_DEPTH)
+		trace_filled++;
+	SREG = sreg;
+}
+
+/*
+ * Stops recording so the ring keeps the events that led up to now.
+ */
+void trace_freeze() {
+	trace_frozen = 1;
+}
+
+/*
+ * Sends the next chunk of a frozen ring, oldest event first, and starts
+ * recording again once it has all gone out. Call once per frame.
+ */
+void trace_dump_step() {
+	uint8_t buf[sizeof(trace_chunk) + TRACE_CHUNK * sizeof(trace_event)];
+	trace_chunk *c = (trace_chunk *) buf;
+	trace_event *e = (trace_event *) (buf + sizeof(trace_chunk));
+	uint8_t oldest, n, i;
+	
+	if (!trace_frozen)
+		return;
+	
+	oldest = (trace_head + TRACE_DEPTH - trace_filled) % TRACE_DEPTH;
+	n = trace_filled - trace_sent;
+	if (n > TRACE_CHUNK)
+		n = TRACE_CHUNK;
+	c->dump = trace_dumps;
+	c->first = trace_sent;
+	c->total = trace_filled;
+	for (i = 0; i < n; i++)
+		e[i] = trace_ring[(oldest + trace_sent + i) % TRACE_DEPTH];
+	
+	if (!telemetry_send(TELE_TRACE, buf, sizeof(trace_chunk) 
+			+ n * sizeof(trace_event)))
+		return; // Try the same chunk again next frame.
+	
+	trace_sent += n;
+	if (trace_sent == trace_filled) {
+		trace_dumps++;
+		trace_sent = 0;
+		trace_filled = 0;
+		trace_frozen = 0;
+	}
+}
+
+#else
+
+void trace_record(uint8_t what) {
+	(void) what;
+}
+
+void trace_freeze() {
+}
+
+void trace_dump_step() {
+}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * Event trace: a ring of begin/end/instant events with 16-bit clock_now()
+ * timestamps. Build with -DTRACE for the game phases and additionally
+ * -DTRACE_LCD for the lcd.c primitives, each run of calls to one of them
+ * kept as a single span. The ring freezes on trace_freeze()
+ * (a tick overrun) and is then sent out over telemetry as TELE_TRACE frames
+ * for tools/trace2json.
+ *
+ * Shared with the host tools, so it must stay free of AVR-only code.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#define TRACE_IDS(X) \
+	X(TR_TICK,            "tick") \
+	X(TR_STEP,            "step") \
+	X(TR_INPUT,           "handle_input") \
+	X(TR_UPDATE,          "update") \
+	X(TR_DRAW,            "draw") \
+	X(TR_DRAW_HUD,        "draw_hud") \
+	X(TR_DRAW_WRECKAGE,   "draw_wreckage") \
+	X(TR_DRAW_SHIP,       "draw_ship") \
+	X(TR_DRAW_BULLETS,    "draw_bullets") \
+	X(TR_DRAW_DEBRIS,     "draw_debris") \
+	X(TR_DRAW_ASTEROIDS,  "draw_asteroids") \
+	X(TR_OVERRUN,         "overrun") \
+	X(TR_LCD_FILL,        "fill_rectangle") \
+	X(TR_LCD_LINE,        "draw_line") \
+	X(TR_LCD_RECT,        "draw_outline_rectangle") \
+	X(TR_LCD_PIXEL,       "draw_pixel") \
+	X(TR_LCD_CHAR,        "display_char") \
+	X(TR_LCD_IMAGE,       "display_image") \
+	X(TR_LCD_SPRITE,      "display_sprite")
+
+#define TRACE_ENUM(id, name) id,
+enum { TRACE_IDS(TRACE_ENUM) TR_COUNT };
+
+#define TR_BEGIN   0x00
+#define TR_END     0x40
+#define TR_INSTANT 0x80
+#define TR_ID_MASK 0x3F
+
+#ifndef TRACE_DEPTH
+#ifdef TRACE_LCD
+#define TRACE_DEPTH 192 // Some three busy frames with their LCD spans.
+#else
+#define TRACE_DEPTH 96
+#endif
+#endif
+#define TRACE_CHUNK 40 // Events per TELE_TRACE frame.
+
+typedef struct {
+	uint16_t time;
+	uint8_t what; // TR_BEGIN/TR_END/TR_INSTANT | id
+} __attribute__((packed)) trace_event;
+
+/* TELE_TRACE payload: this header, then count trace_events. */
+typedef struct {
+	uint16_t dump;  // Increments per frozen ring sent.
+	uint8_t first;  // Index of the first event in this chunk.
+	uint8_t total;  // Events in the whole dump.
+} __attribute__((packed)) trace_chunk;
+
+#ifdef TRACE
+#define TRACE_BEGIN(id)   trace_record(TR_BEGIN | (id))
+#define TRACE_END(id)     trace_record(TR_END | (id))
+#define TRACE_INSTANT(id) trace_record(TR_INSTANT | (id))
+#else
+#define TRACE_BEGIN(id)   do {} while (0)
+#define TRACE_END(id)     do {} while (0)
+#define TRACE_INSTANT(id) do {} while (0)
+#endif
+
+#ifdef TRACE_LCD
+#define TRACE_LCD_BEGIN(id) TRACE_BEGIN(id)
+#define TRACE_LCD_END(id)   TRACE_END(id)
+#else
+#define TRACE_LCD_BEGIN(id) do {} while (0)
+#define TRACE_LCD_END(id)   do {} while (0)
+#endif
+
+void trace_record(uint8_t what);
+void trace_freeze();
+void trace_dump_step();
+
+#endif